@@ -0,0 +1,73 @@
+/*
+ *  scheduler.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Stand-in for nestkernel/scheduler.h, providing only what
+ * SliceRingBuffer needs, so that the benchmark can be built
+ * without the rest of NEST.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cassert>
+
+#include "nest.h"
+
+namespace nest
+{
+  class Scheduler
+  {
+  public:
+    //! set delays in steps and move to the first slice
+    static void set_delays(delay min_delay, delay max_delay)
+    {
+      min_delay_ = min_delay;
+      max_delay_ = max_delay;
+      n_slices_ = (min_delay + max_delay + min_delay - 1) / min_delay;
+      origin_ = 0;
+    }
+
+    //! move to the next slice
+    static void advance() { origin_ += min_delay_; }
+
+    //! time step at the beginning of the current slice
+    static long_t get_origin() { return origin_; }
+
+    static delay get_min_delay() { return min_delay_; }
+    static delay get_max_delay() { return max_delay_; }
+
+    static delay get_slice_modulo(delay d)
+    {
+      assert(d >= 0 && d < min_delay_ + max_delay_);
+      return ((origin_ + d) / min_delay_) % n_slices_;
+    }
+
+  private:
+    static delay min_delay_;
+    static delay max_delay_;
+    static delay n_slices_;
+    static long_t origin_;
+  };
+}
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ *  slice_ring_buffer_benchmark.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+   Micro-benchmark for SliceRingBuffer, the input queue of the precise
+   neuron models, without the rest of NEST.
+
+   n_neurons queues receive off-grid spikes at several rates per time
+   step (resolution 0.1 ms, delays 1 to 2 ms) and deliver them step by
+   step, as the precise models do. Spikes arrive either in temporal
+   order, as from devices delivering lag by lag, or in random order, as
+   from a network with random delays. The input of a few slices is drawn
+   in advance and reused, so that only queueing and delivery is timed.
+   The benchmark reports the best of several runs as time per spike
+   for adding and for delivering spikes, the latter including sorting,
+   and a checksum of the delivered weights, which must agree between
+   versions of SliceRingBuffer.
+
+   Build it against the SliceRingBuffer of the tree with
+
+     g++ -O2 -DNDEBUG -I. -I../../precise -I../../nestkernel \
+       slice_ring_buffer_benchmark.cpp ../../precise/slice_ring_buffer.cpp
+
+   and against another version by pointing the second -I and the last
+   argument to its precise directory. scheduler.h and config.h in this
+   directory stand in for those of NEST.
+*/
+
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+#include "slice_ring_buffer.h"
+
+nest::delay nest::Scheduler::min_delay_ = 0;
+nest::delay nest::Scheduler::max_delay_ = 0;
+nest::delay nest::Scheduler::n_slices_ = 0;
+nest::long_t nest::Scheduler::origin_ = 0;
+
+namespace
+{
+  const size_t n_neurons = 1000;
+  const size_t n_slices = 500;      // 50 ms
+  const size_t n_inputs = 8;        // slices of input drawn in advance
+  const size_t n_runs = 5;
+  const nest::delay min_delay = 10; // steps
+  const nest::delay max_delay = 20;
+  const double resolution = 0.1;    // ms
+
+  // xorshift64, fast and sufficient here
+  unsigned long long rng_state = 88172645463325252ULL;
+
+  unsigned long long next_rand()
+  {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+  }
+
+  double drand()
+  {
+    return (next_rand() >> 11) * (1.0 / 9007199254740992.0);
+  }
+
+  struct Spike
+  {
+    size_t neuron;
+    nest::delay rel_delivery;
+    double offset;
+    double weight;
+  };
+
+  // draw the spikes arriving during one slice, in order of arrival
+  void draw_input(size_t rate, bool ordered, std::vector<Spike>& input)
+  {
+    input.clear();
+    if ( ordered )
+    {
+      // devices deliver lag by lag with delay min_delay
+      for ( nest::delay lag = 0 ; lag < min_delay ; ++lag )
+        for ( size_t n = 0 ; n < n_neurons ; ++n )
+          for ( size_t k = 0 ; k < rate ; ++k )
+          {
+            const Spike s = { n, min_delay + lag, resolution * drand(), 1.0 + drand() };
+            input.push_back(s);
+          }
+    }
+    else
+    {
+      // spikes with random lags and delays
+      for ( size_t n = 0 ; n < n_neurons ; ++n )
+        for ( size_t k = 0 ; k < rate * min_delay ; ++k )
+        {
+          const nest::delay lag = next_rand() % min_delay;
+          const nest::delay d = min_delay + next_rand() % (max_delay - min_delay);
+          const Spike s = { n, d + lag, resolution * drand(), 1.0 + drand() };
+          input.push_back(s);
+        }
+    }
+  }
+
+  // deliver the spikes of the current slice as the precise models do
+  double deliver(std::vector<nest::SliceRingBuffer>& queues)
+  {
+    double sum = 0.0;
+    for ( size_t n = 0 ; n < queues.size() ; ++n )
+    {
+      queues[n].prepare_delivery();
+      for ( nest::delay lag = 0 ; lag < min_delay ; ++lag )
+      {
+        const nest::long_t T = nest::Scheduler::get_origin() + lag + 1;
+        double offset, weight;
+        bool end_of_refract;
+        while ( queues[n].get_next_spike(T, offset, weight, end_of_refract) )
+          sum += weight * (1.0 + offset);
+      }
+    }
+    return sum;
+  }
+
+  // simulate n_slices, return checksum and set time taken by adding
+  // and by delivering spikes
+  double simulate(const std::vector<std::vector<Spike> >& inputs,
+                  double& t_add, double& t_deliver)
+  {
+    nest::Scheduler::set_delays(min_delay, max_delay);
+    std::vector<nest::SliceRingBuffer> queues(n_neurons);
+    for ( size_t n = 0 ; n < n_neurons ; ++n )
+      queues[n].resize();
+
+    double sum = 0.0;
+    std::clock_t c_add = 0;
+    std::clock_t c_deliver = 0;
+
+    for ( size_t s = 0 ; s < n_slices ; ++s )
+    {
+      const std::clock_t start = std::clock();
+      sum += deliver(queues);
+      const std::clock_t mid = std::clock();
+
+      const std::vector<Spike>& input = inputs[s % inputs.size()];
+      for ( size_t i = 0 ; i < input.size() ; ++i )
+      {
+        const nest::long_t stamp =
+          nest::Scheduler::get_origin() + input[i].rel_delivery + 1;
+        queues[input[i].neuron].add_spike(input[i].rel_delivery, stamp,
+                                          input[i].offset, input[i].weight);
+      }
+
+      c_deliver += mid - start;
+      c_add += std::clock() - mid;
+      nest::Scheduler::advance();
+    }
+
+    t_add = static_cast<double>(c_add) / CLOCKS_PER_SEC;
+    t_deliver = static_cast<double>(c_deliver) / CLOCKS_PER_SEC;
+    return sum;
+  }
+
+  // spikes per step and neuron, in temporal order or not
+  void run(size_t rate, bool ordered)
+  {
+    std::vector<std::vector<Spike> > inputs(n_inputs);
+    for ( size_t i = 0 ; i < n_inputs ; ++i )
+      draw_input(rate, ordered, inputs[i]);
+
+    double t_add = 0.0;
+    double t_deliver = 0.0;
+    double sum = 0.0;
+    for ( size_t r = 0 ; r < n_runs ; ++r )
+    {
+      double t_a, t_d;
+      sum = simulate(inputs, t_a, t_d);
+      if ( r == 0 || t_a < t_add )
+        t_add = t_a;
+      if ( r == 0 || t_d < t_deliver )
+        t_deliver = t_d;
+    }
+
+    const double n_spikes = static_cast<double>(n_slices) * n_neurons * rate * min_delay;
+    std::printf("%-8s %3lu spikes/step: add %5.1f, deliver %5.1f ns/spike,"
+                " checksum %.6e\n",
+                ordered ? "ordered" : "random", static_cast<unsigned long>(rate),
+                1e9 * t_add / n_spikes, 1e9 * t_deliver / n_spikes, sum);
+  }
+}
+
+int main()
+{
+  const size_t rates[] = { 1, 5, 20 };
+  for ( size_t i = 0 ; i < 3 ; ++i )
+  {
+    run(rates[i], true);
+    run(rates[i], false);
+  }
+  return 0;
+}
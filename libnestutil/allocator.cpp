@@ -120,7 +120,8 @@ void sli::pool::grow(size_t nelements)
 
   for(char *p=start; p<last; p+=el_size)
     reinterpret_cast<link*>(p)->next=reinterpret_cast<link*>(p+el_size);
-  reinterpret_cast<link*>(last)->next = NULL;
+  // keep remaining free elements behind the new ones
+  reinterpret_cast<link*>(last)->next = head;
   head = reinterpret_cast<link*>(start);
 
 }
@@ -139,6 +140,93 @@ void sli::pool::reserve_additional(size_t n)
 }
 
 
+sli::arena::arena(size_t s)
+  : chunk_size(s),
+    total(0),
+    used(0),
+    capacity(0),
+    head(0),
+    chunks(0),
+    free_blocks()
+{}
+
+sli::arena::arena(const sli::arena &a)
+  : chunk_size(a.chunk_size),
+    total(0),
+    used(0),
+    capacity(0),
+    head(0),
+    chunks(0),
+    free_blocks()
+{}
+
+sli::arena & sli::arena::operator=(const sli::arena &a)
+{
+  if(&a == this)
+    return *this;
+
+  // assignment yields an empty arena, as for pool
+  chunk *n=chunks;
+  while(n)
+  {
+    chunk *p=n;
+    n=n->next;
+    delete p;
+  }
+
+  chunk_size=a.chunk_size;
+  total=0;
+  used=0;
+  capacity=0;
+  head=0;
+  chunks=0;
+  free_blocks.clear();
+
+  return *this;
+}
+
+sli::arena::~arena()
+{
+  chunk *n=chunks;
+  while(n)
+  {
+    chunk *p=n;
+    n=n->next;
+    delete p;
+  }
+}
+
+void sli::arena::grow(size_t n)
+{
+  // the remainder of the current chunk is abandoned
+  const size_t s = n < chunk_size ? chunk_size : n;
+  chunks   = new chunk(s, chunks);
+  total   += s;
+  head     = chunks->mem;
+  capacity = s;
+}
+
+void sli::arena::free(void *p, size_t n)
+{
+  n = block_size(n);
+  if ( n == 0 )
+    return;
+  assert(used >= n);
+
+  link *l = static_cast<link*>(p);
+  link *&first = free_blocks[n];
+  l->next = first;
+  first = l;
+  used -= n;
+}
+
+void sli::arena::reserve_additional(size_t n)
+{
+  if(capacity < n)
+    grow(n);
+}
+
+
 // --- Code below is for the PoorMan's Allocator
 #ifdef USE_PMA
 
@@ -24,6 +24,7 @@
 #define ALLOCATOR_H
 #include <cassert>
 #include <cstdlib>
+#include <map>
 #include <string>
 
 namespace sli {
@@ -178,6 +179,103 @@ namespace sli {
     return total;
   }
 
+  /**
+   * arena is a bump allocator for blocks of arbitrary size which are
+   * laid out contiguously in the order of allocation. A block that is
+   * freed is kept in a free list for its size and handed out again by
+   * the next allocation of that size; memory is only returned to the
+   * system when the arena is destroyed. Copies of an arena are empty,
+   * as for pool.
+   * @ingroup MemoryManagement
+   */
+  class arena
+  {
+    struct link { link *next; };
+
+    struct chunk
+    {
+      chunk(size_t s, chunk* n) : mem(new char[s]), next(n) {}
+      ~chunk() { delete [] mem; }
+      char  *mem;
+      chunk *next;
+    };
+
+    size_t chunk_size; //!< minimal size of a chunk in bytes
+    size_t total;      //!< total number of allocated bytes
+    size_t used;       //!< number of bytes handed out
+    size_t capacity;   //!< number of free bytes in current chunk
+    char  *head;       //!< next free byte in current chunk
+    chunk *chunks;     //!< linked list of memory chunks
+
+    //! free blocks by size in bytes
+    std::map<size_t, link*> free_blocks;
+
+    void grow(size_t); //!< add chunk of at least n bytes
+
+    //! size of a block of n bytes, such that blocks stay aligned
+    static size_t block_size(size_t n)
+      { return ( n + 15 ) & ~static_cast<size_t>(15); }
+
+   public:
+    /** Create arena which allocates memory in chunks of at least
+     *  chunk_size bytes.
+     */
+    arena(size_t chunk_size=65536);
+    arena(const arena &);
+    arena& operator=(const arena &);
+
+    ~arena();              //!< deallocate ALL memory
+
+    /**
+     * Reserve n bytes, so that the next allocations of n bytes in
+     * total are contiguous.
+     */
+    void reserve_additional(size_t n);
+
+    inline void *alloc(size_t n);  //!< allocate n bytes
+
+    /**
+     * Return a block of n bytes obtained from alloc(n) for reuse.
+     */
+    void free(void *p, size_t n);
+
+    size_t get_total() const
+      { return total; }
+
+    //! number of bytes handed out and not freed
+    size_t get_used() const
+      { return used; }
+  };
+
+  inline
+  void * arena::alloc(size_t n)
+  {
+    // keep blocks aligned for double and pointer members
+    n = block_size(n);
+
+    if ( not free_blocks.empty() )
+    {
+      std::map<size_t, link*>::iterator it = free_blocks.find(n);
+      if ( it != free_blocks.end() && it->second != 0 )
+      {
+        link *p = it->second;
+        it->second = p->next;
+        used += n;
+        return p;
+      }
+    }
+
+    if ( n > capacity )
+      grow(n);
+
+    char *p = head;
+    head     += n;
+    capacity -= n;
+    used     += n;
+
+    return p;
+  }
+
 }
 
 #ifdef USE_PMA
@@ -100,6 +100,10 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! draw values one by one through the clipping operator
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+    void lfill(RngPtr r, long* v, size_t n) const { RandomDev::lfill(r, v, n); }
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -209,6 +213,10 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! draw values one by one through the clipping operator
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+    void lfill(RngPtr r, long* v, size_t n) const { RandomDev::lfill(r, v, n); }
+
     long ldev(void);
     long ldev(RngPtr) const;
 
@@ -340,6 +348,10 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! draw values one by one through the clipping operator
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+    void lfill(RngPtr r, long* v, size_t n) const { RandomDev::lfill(r, v, n); }
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -452,6 +464,10 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! draw values one by one through the clipping operator
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+    void lfill(RngPtr r, long* v, size_t n) const { RandomDev::lfill(r, v, n); }
+
     long ldev(void);
     long ldev(RngPtr) const;
 
@@ -21,6 +21,7 @@
  */
 
 #include <cmath>
+#include <vector>
 #include "config.h"
 #include "normal_randomdev.h"
 #include "sliexceptions.h"
@@ -80,3 +81,33 @@ double librandom::NormalRandomDev::operator()(RngPtr r) const
 
   return mu_ + sigma_ * S;
 }
+
+void librandom::NormalRandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  // Same algorithm as operator(). Every deviate consumes at least one
+  // pair of uniform numbers, so drawing one pair per missing deviate
+  // never takes numbers from the RNG that operator() would not take.
+  std::vector<double> u;
+  size_t i = 0;
+
+  while ( i < n )
+  {
+    u.resize(2 * (n - i));
+    r->drand(&u[0], u.size());
+
+    for ( size_t k = 0 ; k < u.size() ; k += 2 )
+    {
+      const double V1 = 2 * u[k] - 1;
+      const double V2 = 2 * u[k+1] - 1;
+      double S = V1*V1 + V2*V2;
+
+      if ( S >= 1 )
+	continue;
+
+      if ( S != 0 )
+	S = V1 * std::sqrt(-2 * std::log(S)/S);
+
+      v[i++] = mu_ + sigma_ * S;
+    }
+  }
+}
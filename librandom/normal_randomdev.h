@@ -70,6 +70,9 @@ Author: Hans Ekkehard Plesser
     using RandomDev::operator();
     double operator()(RngPtr) const;  // threaded
 
+    //! fill v[0..n-1], drawing the uniform numbers in bulk
+    void fill(RngPtr, double* v, size_t n) const;
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -0,0 +1,114 @@
+/*
+ *  philox.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "philox.h"
+
+const size_t librandom::PhiloxRandomGen::BUFFSIZE_ = 16;
+const double librandom::PhiloxRandomGen::I2DFactor_ = 1.0 / 9007199254740992.0; // 2^-53
+
+librandom::PhiloxRandomGen::PhiloxRandomGen(unsigned long seed) :
+  block_(0),
+  next_(2)
+{
+  stream_[0] = stream_[1] = stream_[2] = 0;
+  set_buffsize(BUFFSIZE_);
+  seed_(seed);
+}
+
+void librandom::PhiloxRandomGen::set_stream(unsigned long s, unsigned long source,
+					    unsigned long target, unsigned long purpose)
+{
+  stream_[0] = static_cast<uint32_t>(source);
+  stream_[1] = static_cast<uint32_t>(target);
+  stream_[2] = static_cast<uint32_t>(purpose);
+
+  // restarts the stream and empties the buffer
+  seed(s);
+}
+
+void librandom::PhiloxRandomGen::seed_(unsigned long seed)
+{
+  const uint64_t s = seed;
+  key_[0] = static_cast<uint32_t>(s);
+  key_[1] = static_cast<uint32_t>(s >> 32);
+
+  block_ = 0;
+  next_ = 2;
+}
+
+void librandom::PhiloxRandomGen::next_block_(double* v)
+{
+  // constants from Salmon et al, 2011
+  const uint64_t M0 = 0xD2511F53UL;
+  const uint64_t M1 = 0xCD9E8D57UL;
+  const uint32_t W0 = 0x9E3779B9UL;
+  const uint32_t W1 = 0xBB67AE85UL;
+
+  uint32_t c0 = block_++;
+  uint32_t c1 = stream_[2];
+  uint32_t c2 = stream_[0];
+  uint32_t c3 = stream_[1];
+  uint32_t k0 = key_[0];
+  uint32_t k1 = key_[1];
+
+  for ( int r = 0 ; r < 10 ; ++r )
+  {
+    if ( r > 0 )
+    {
+      k0 += W0;
+      k1 += W1;
+    }
+
+    const uint64_t p0 = M0 * c0;
+    const uint64_t p1 = M1 * c2;
+    const uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    const uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    c1 = static_cast<uint32_t>(p1);
+    c3 = static_cast<uint32_t>(p0);
+    c0 = n0;
+    c2 = n2;
+  }
+
+  v[0] = I2DFactor_ * static_cast<double>((static_cast<uint64_t>(c0) << 21) ^ (c1 >> 11));
+  v[1] = I2DFactor_ * static_cast<double>((static_cast<uint64_t>(c2) << 21) ^ (c3 >> 11));
+}
+
+void librandom::PhiloxRandomGen::fill_(double* v, size_t n)
+{
+  // deliver what is left from the last single draw first,
+  // so that the sequence is the same as for n calls to drand_()
+  while ( n > 0 && next_ < 2 )
+  {
+    *v++ = out_[next_++];
+    --n;
+  }
+
+  for ( ; n >= 2 ; n -= 2, v += 2 )
+    next_block_(v);
+
+  if ( n > 0 )
+  {
+    next_block_(out_);
+    v[0] = out_[0];
+    next_ = 1;
+  }
+}
@@ -0,0 +1,110 @@
+/*
+ *  philox.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <stdint.h>
+
+#include "randomgen.h"
+
+namespace librandom {
+
+  /**
+   * Counter-based Philox4x32-10 generator.
+   *
+   * Philox (Salmon et al, Parallel random numbers: as easy as 1, 2, 3,
+   * SC11, 2011) computes each block of random numbers as a keyed
+   * bijection of a counter, so that any block can be computed without
+   * generating the preceding ones. The key is given by the seed, the
+   * counter consists of a block number and the stream given to
+   * set_stream(). Each stream (seed, source, target, purpose) thus
+   * delivers its own sequence, no matter which thread or process draws
+   * from it. Each block gives two numbers with 53 random bits.
+   *
+   * Source, target and purpose are taken modulo 2^32. Each stream can
+   * deliver 2^33 numbers.
+   *
+   * The generator is registered in rngdict as philox4x32.
+   */
+  class PhiloxRandomGen : public RandomGen {
+  public:
+
+    //! Create generator with given seed, drawing from stream (0, 0, 0)
+    explicit PhiloxRandomGen(unsigned long);
+
+    ~PhiloxRandomGen() {};
+
+    RngPtr clone(unsigned long s)
+      {
+	return RngPtr(new PhiloxRandomGen(s));
+      }
+
+    /**
+     * Start drawing from the beginning of the stream (seed, source,
+     * target, purpose).
+     */
+    void set_stream(unsigned long seed, unsigned long source,
+		    unsigned long target, unsigned long purpose);
+
+  private:
+    //! implements seeding for RandomGen, restarts the current stream
+    void   seed_(unsigned long);
+
+    //! implements drawing a single [0,1) number for RandomGen
+    double drand_();
+
+    //! implements drawing n [0,1) numbers for RandomGen
+    void   fill_(double*, size_t);
+
+    //! compute next block of the current stream, writing two numbers to v
+    void   next_block_(double* v);
+
+    /**
+     * Buffer size. It is small since streams are short and every
+     * set_stream() discards the buffer, which is refilled on the next draw.
+     */
+    static const size_t BUFFSIZE_;
+    static const double I2DFactor_;  //!< 53-bit int to double factor
+
+    uint32_t key_[2];      //!< key, given by the seed
+    uint32_t stream_[3];   //!< source, target and purpose
+    uint32_t block_;       //!< number of next block in stream
+    double   out_[2];      //!< numbers from the last block, for drand_()
+    size_t   next_;        //!< next entry of out_ to deliver
+  };
+
+  inline
+  double PhiloxRandomGen::drand_()
+  {
+    if ( next_ == 2 )
+    {
+      next_block_(out_);
+      next_ = 0;
+    }
+
+    return out_[next_++];
+  }
+
+}  // namespace librandom
+
+#endif
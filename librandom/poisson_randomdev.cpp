@@ -296,6 +296,38 @@ long librandom::PoissonRandomDev::ldev(RngPtr r) const
 
 }
 
+void librandom::PoissonRandomDev::lfill(RngPtr r, long* v, size_t n) const
+{
+  assert(r.valid());
+
+  if ( mu_ == 0.0 )
+  {
+    std::fill(v, v + n, 0L);
+    return;
+  }
+
+  if ( mu_ >= 10.0 )
+  {
+    // case A consumes a variable number of uniform numbers per deviate
+    RandomDev::lfill(r, v, n);
+    return;
+  }
+
+  // Case B in Ahrens & Dieter takes exactly one uniform number per
+  // deviate, so all numbers can be drawn at once
+  std::vector<double> U(n);
+  if ( n > 0 )
+    r->drand(&U[0], n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    unsigned long K = 0;
+    while ( U[i] > P_[K] && K != n_tab_ )
+      ++K;
+    v[i] = K;
+  }
+}
+
 void librandom::PoissonRandomDev::proc_f_(const unsigned K, 
 					  double &px, double &py, 
 					  double &fx, double &fy) const
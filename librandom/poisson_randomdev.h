@@ -133,6 +133,7 @@ Author: Hans Ekkehard Plesser
     using RandomDev::ldev;
 
     long ldev(RngPtr) const;   //!< draw integer, threaded
+    void lfill(RngPtr, long* v, size_t n) const; //!< draw n integers, threaded
     bool has_ldev() const { return true; }
 
     double operator()(RngPtr) const;     //!< return as double, threaded
@@ -20,6 +20,8 @@
  *
  */
 
+#include <vector>
+
 #include "config.h"
 #include "dict.h"
 #include "dictdatum.h"
@@ -34,6 +36,8 @@
 #include "random_datums.h"
 #include "knuthlfg.h"
 #include "mt19937.h"
+#include "xoroshiro.h"
+#include "philox.h"
 #include "gslrandomgen.h"
 #include "clipped_randomdev.h"
 
@@ -112,6 +116,8 @@ void RandomNumbers::init(SLIInterpreter *i)
   // add built-in rngs
   register_rng_<librandom::KnuthLFG>("knuthlfg", *rngdict_);
   register_rng_<librandom::MT19937>("MT19937", *rngdict_);
+  register_rng_<librandom::Xoroshiro128x8>("xoroshiro128x8", *rngdict_);
+  register_rng_<librandom::PhiloxRandomGen>("philox4x32", *rngdict_);
 
   // let GslRandomGen add all of the GSL rngs
   librandom::GslRandomGen::add_gsl_rngs(*rngdict_);
@@ -159,6 +165,7 @@ void RandomNumbers::init(SLIInterpreter *i)
   i->createcommand("seed_g_i",&seedfunction);
   i->createcommand("irand_g_i",&irandfunction);
   i->createcommand("drand_g",&drandfunction);
+  i->createcommand("drand_g_i",&drand_g_ifunction);
 
   i->createcommand("RandomArray_v_i", &randomarrayfunction);
   i->createcommand("Random_i", &randomfunction);
@@ -274,6 +281,31 @@ void RandomNumbers::DrandFunction::execute(SLIInterpreter *i) const
   i->EStack.pop();
 }
 
+// rng n drand_g_i -> [r_1 ... r_n], drawn in one block via drand(v, n);
+// gives the same numbers as n calls to drand_g
+void RandomNumbers::Drand_g_iFunction::execute(SLIInterpreter *i) const 
+{
+  i->assert_stack_load(2);
+
+  const long n = getValue<long>(i->OStack.top());
+  librandom::RngDatum rng = getValue<librandom::RngDatum>(i->OStack.pick(1));
+
+  if ( n < 0 )
+    throw RangeCheck();
+
+  std::vector<double> v(n);
+  if ( n > 0 )
+    rng->drand(&v[0], n);
+
+  TokenArray result;
+  result.reserve(n);
+  for ( long j = 0 ; j < n ; ++j )
+    result.push_back(v[j]);
+
+  i->OStack.pop(2);
+  i->OStack.push(ArrayDatum(result));
+  i->EStack.pop();
+}
 
 /* see librandom.sli for SLI documentation */
 void RandomNumbers::RandomArrayFunction::execute(SLIInterpreter *i) const
@@ -283,15 +315,33 @@ void RandomNumbers::RandomArrayFunction::execute(SLIInterpreter *i) const
   librandom::RdvDatum rdv = getValue<librandom::RdvDatum>(i->OStack.pick(1));
   const long n = getValue<long>(i->OStack.pick(0));
 
+  if ( n < 0 )
+    throw RangeCheck();
+
+  librandom::RngPtr rng = rdv->get_rng();
+  assert(rng.valid());
+
+  // draw all deviates at once, so that RDGs can draw the
+  // underlying uniform numbers in bulk
   TokenArray result;
   result.reserve(n);
 
   if ( rdv->has_ldev() )
+  {
+    std::vector<long> v(n);
+    if ( n > 0 )
+      rdv->lfill(rng, &v[0], n);
     for( long j = 0; j < n ; ++j)
-      result.push_back(rdv->ldev());
+      result.push_back(v[j]);
+  }
   else
-    for( long j=0; j<n ; ++j)
-      result.push_back( (*rdv)() );
+  {
+    std::vector<double> v(n);
+    if ( n > 0 )
+      rdv->fill(rng, &v[0], n);
+    for( long j = 0; j < n ; ++j)
+      result.push_back(v[j]);
+  }
   
   i->OStack.pop(2);
   i->OStack.push(ArrayDatum(result));
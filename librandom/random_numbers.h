@@ -115,6 +115,12 @@ class RandomNumbers: public SLIModule
     void execute(SLIInterpreter *) const;
   };
 
+  class Drand_g_iFunction: public SLIFunction
+  {
+    public:
+    void execute(SLIInterpreter *) const;
+  };
+
   class SeedFunction: public SLIFunction  
   {
     public:
@@ -146,6 +152,7 @@ class RandomNumbers: public SLIModule
   SeedFunction seedfunction;
   IrandFunction irandfunction;
   DrandFunction drandfunction;
+  Drand_g_iFunction drand_g_ifunction;
 
   RandomArrayFunction randomarrayfunction;
   RandomFunction randomfunction;
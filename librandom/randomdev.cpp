@@ -28,3 +28,14 @@ long librandom::RandomDev::ldev(RngPtr) const
   return 0;
 }
 
+void librandom::RandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = (*this)(r);
+}
+
+void librandom::RandomDev::lfill(RngPtr r, long* v, size_t n) const
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = ldev(r);
+}
@@ -161,6 +161,15 @@ namespace librandom {
     virtual long ldev(void);
     virtual long ldev(RngPtr) const;
 
+    /**
+     * Fill v[0], ..., v[n-1] with deviates.
+     * The result is the same as for n calls to operator()(RngPtr),
+     * resp. ldev(RngPtr), but RDGs may override these functions to
+     * draw the underlying uniform numbers in bulk.
+     */
+    virtual void fill(RngPtr, double* v, size_t n) const;
+    virtual void lfill(RngPtr, long* v, size_t n) const;
+
     /**
      * true if RDG implements ldev function
      */
@@ -169,6 +178,9 @@ namespace librandom {
     //! set RNG
     void set_rng(RngPtr rng) { rng_ = rng; }
 
+    //! get RNG, invalid for RDGs created for multithreaded use
+    RngPtr get_rng() const { return rng_; }
+
     /**
      * set distribution parameters from SLI interface
      *
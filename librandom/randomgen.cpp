@@ -20,6 +20,8 @@
  *
  */
 
+#include <algorithm>
+
 #include "randomgen.h"
 #include "knuthlfg.h"
 
@@ -64,12 +66,30 @@ void librandom::RandomGen::seed(const unsigned long n)
   next_ = end_;
 }
 
-void librandom::RandomGen::refill_(void)
+void librandom::RandomGen::drand(double* v, size_t n)
 {
-  std::vector<double>::iterator i;
+  while ( n > 0 )
+  {
+    if ( next_ == end_ )
+      refill_();
 
-  for ( i = buffer_.begin(); i != buffer_.end() ; ++i )
-    *i = drand_();
+    const size_t m = std::min(n, static_cast<size_t>(end_ - next_));
+    std::copy(next_, next_ + m, v);
+    next_ += m;
+    v += m;
+    n -= m;
+  }
+}
+
+void librandom::RandomGen::fill_(double* v, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = drand_();
+}
+
+void librandom::RandomGen::refill_(void)
+{
+  fill_(&buffer_[0], buffer_.size());
 
   next_ = buffer_.begin();
 }
@@ -112,6 +112,7 @@
  *        ()                   [0, 1)                            
  * double drandpos()           (0, 1)                            
  * ulong  ulrand(N)            [0, N-1]                          
+ * void   drand(v, n)          fill v[0..n-1] from [0, 1)
  *                                                          
  * void   seed(N)              seed the RNG, N: ulong            
  *                                                          
@@ -135,12 +136,16 @@
  * @note
  * For a list of available RNGs, see rngdict info in SLI.
  *
- * NEST comes at present with two built-in random number generators:
+ * NEST comes at present with four built-in random number generators:
  * - knuthlfg, the lagged Fibonacci generator from D.E.Knuth,
  *   The Art of Computer Programming, 3rd ed, vol 2, sec 3.6.
  * - MT19937, the Mersenne Twister by Matsumoto and Nishimura.
- * Implementations of both are directly derived from free code published
- * by the original authors.
+ * - xoroshiro128x8, eight interleaved xoroshiro128+ generators by
+ *   Blackman and Vigna, which refills the buffer in vectorizable blocks.
+ * - philox4x32, the counter-based Philox4x32-10 by Salmon et al, which
+ *   provides independent streams selected by set_stream().
+ * Implementations of the first two are directly derived from free code
+ * published by the original authors.
  *
  * If the GNU Scientific Library (v 1.2 or later) is installed,
  * all uniform random number generators from the GSL are made available,
@@ -265,6 +270,13 @@ namespace librandom {
     double        drandpos(void);              //!< draw from (0, 1) 
     unsigned long ulrand(const unsigned long); //!< draw from [0, n-1]   
 
+    /**
+     * Fill v[0], ..., v[n-1] with numbers from [0, 1).
+     * The numbers are the same as those returned by n consecutive
+     * calls to drand(), but are copied from the buffer in blocks.
+     */
+    void          drand(double* v, size_t n);
+
     void seed(const unsigned long);   //!< set random seed to a new value 
 
     size_t get_buffsize(void) const;  //!< returns buffer size
@@ -294,6 +306,13 @@ namespace librandom {
     virtual void seed_(unsigned long) =0;  //!< seeding interface
     virtual double drand_() =0;            //!< drawing interface
 
+    /**
+     * Fill v[0], ..., v[n-1] with numbers from [0, 1), used to refill
+     * the buffer. The default calls drand_() n times; generators that
+     * can produce several numbers at once should override it.
+     */
+    virtual void fill_(double* v, size_t n);
+
   private:
 
     void refill_();    //!< refill buffer
@@ -0,0 +1,79 @@
+/*
+ *  xoroshiro.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+
+#include "xoroshiro.h"
+
+const size_t librandom::Xoroshiro128x8::LANES_;
+const double librandom::Xoroshiro128x8::I2DFactor_ = 1.0 / 9007199254740992.0; // 2^-53
+
+librandom::Xoroshiro128x8::Xoroshiro128x8(unsigned long seed) :
+  next_(LANES_)
+{
+  seed_(seed);
+}
+
+void librandom::Xoroshiro128x8::seed_(unsigned long seed)
+{
+  // splitmix64, as recommended by the authors of xoroshiro128+
+  uint64_t x = seed;
+  for ( size_t l = 0 ; l < LANES_ ; ++l )
+  {
+    uint64_t *s[2] = { &s0_[l], &s1_[l] };
+    for ( size_t k = 0 ; k < 2 ; ++k )
+    {
+      uint64_t z = ( x += 0x9e3779b97f4a7c15ULL );
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      *s[k] = z ^ (z >> 31);
+    }
+
+    // the all-zero state is a fixed point
+    if ( s0_[l] == 0 && s1_[l] == 0 )
+      s1_[l] = 1;
+  }
+
+  // mark as needing a step
+  next_ = LANES_;
+}
+
+void librandom::Xoroshiro128x8::fill_(double* v, size_t n)
+{
+  // deliver what is left from the last single draw first,
+  // so that the sequence is the same as for n calls to drand_()
+  while ( n > 0 && next_ < LANES_ )
+  {
+    *v++ = out_[next_++];
+    --n;
+  }
+
+  for ( ; n >= LANES_ ; n -= LANES_, v += LANES_ )
+    step_(v);
+
+  if ( n > 0 )
+  {
+    step_(out_);
+    std::copy(out_, out_ + n, v);
+    next_ = n;
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ *  xoroshiro.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XOROSHIRO_H
+#define XOROSHIRO_H
+
+#include <stdint.h>
+
+#include "randomgen.h"
+
+namespace librandom {
+
+  /**
+   * Multi-lane xoroshiro128+ generator.
+   *
+   * Runs LANES_ independent xoroshiro128+ generators (Blackman and Vigna,
+   * 2018) side by side and delivers their outputs interleaved: one number
+   * from lane 0, one from lane 1, and so on. Advancing all lanes at once
+   * is a loop without dependencies between iterations, which the compiler
+   * can vectorize; fill_() uses it to refill the RandomGen buffer.
+   *
+   * The lanes are seeded from the seed via splitmix64. The generator is
+   * registered in rngdict as xoroshiro128x8.
+   */
+  class Xoroshiro128x8 : public RandomGen {
+  public:
+
+    //! Create generator with given seed
+    explicit Xoroshiro128x8(unsigned long);
+
+    ~Xoroshiro128x8() {};
+
+    RngPtr clone(unsigned long s)
+      {
+	return RngPtr(new Xoroshiro128x8(s));
+      }
+
+  private:
+    //! implements seeding for RandomGen
+    void   seed_(unsigned long);
+
+    //! implements drawing a single [0,1) number for RandomGen
+    double drand_();
+
+    //! implements drawing n [0,1) numbers for RandomGen
+    void   fill_(double*, size_t);
+
+    //! advance all lanes by one step, writing one number per lane to v
+    void   step_(double* v);
+
+    static const size_t LANES_ = 8; //!< number of lanes
+    static const double I2DFactor_; //!< 53-bit int to double factor
+
+    uint64_t s0_[LANES_];   //!< first state word of each lane
+    uint64_t s1_[LANES_];   //!< second state word of each lane
+    double   out_[LANES_];  //!< numbers from the last step, for drand_()
+    size_t   next_;         //!< next entry of out_ to deliver
+  };
+
+  inline
+  void Xoroshiro128x8::step_(double* v)
+  {
+    for ( size_t l = 0 ; l < LANES_ ; ++l )
+    {
+      const uint64_t a = s0_[l];
+      const uint64_t b = s1_[l] ^ a;
+      v[l] = I2DFactor_ * static_cast<double>((a + s1_[l]) >> 11);
+      s0_[l] = ((a << 24) | (a >> 40)) ^ b ^ (b << 16);
+      s1_[l] = (b << 37) | (b >> 27);
+    }
+  }
+
+  inline
+  double Xoroshiro128x8::drand_()
+  {
+    if ( next_ == LANES_ )
+    {
+      step_(out_);
+      next_ = 0;
+    }
+
+    return out_[next_++];
+  }
+
+}  // namespace librandom
+
+#endif
@@ -40,6 +40,7 @@
 #include <iomanip>
 #include <iostream>
 #include <cstdio>
+#include <vector>
 
 /* ---------------------------------------------------------------- 
  * Recordables map
@@ -117,6 +118,45 @@ int nest::aeif_cond_alpha_dynamics (double, const double y[], double f[], void*
   return GSL_SUCCESS;
 }
 
+void nest::aeif_cond_alpha::Dynamics_::operator()(const double_t* y, double_t* f, size_t n) const
+{
+  // a shorthand
+  typedef nest::aeif_cond_alpha::State_ S;
+
+  // the largest admissible value for the exponential spike upstroke
+  static const double_t largest_exp=std::exp(10.);
+
+  // same equations as in aeif_cond_alpha_dynamics, for n neurons
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    const Parameters_& p = *P[i];
+
+    const double_t V     = y[S::V_M    * n + i];
+    const double_t dg_ex = y[S::DG_EXC * n + i];
+    const double_t  g_ex = y[S::G_EXC  * n + i];
+    const double_t dg_in = y[S::DG_INH * n + i];
+    const double_t  g_in = y[S::G_INH  * n + i];
+    const double_t w     = y[S::W      * n + i];
+
+    const double_t I_syn_exc = g_ex * (V - p.E_ex);
+    const double_t I_syn_inh = g_in * (V - p.E_in);
+
+    const double_t exp_arg=(V - p.V_th) / p.Delta_T;
+    const double_t I_spike = (exp_arg>10.)? largest_exp : p.Delta_T * std::exp(exp_arg);
+
+    f[S::V_M    * n + i] = ( -p.g_L *( (V-p.E_L) - I_spike )
+                             - I_syn_exc - I_syn_inh - w + p.I_e + I_stim[i]) / p.C_m;
+
+    f[S::DG_EXC * n + i] = -dg_ex / p.tau_syn_ex;
+    f[S::G_EXC  * n + i] =  dg_ex - g_ex / p.tau_syn_ex;
+
+    f[S::DG_INH * n + i] = -dg_in / p.tau_syn_in;
+    f[S::G_INH  * n + i] =  dg_in - g_in / p.tau_syn_in;
+
+    f[S::W      * n + i] = ( p.a * (V - p.E_L) - w ) / p.tau_w;
+  }
+}
+
 /* ---------------------------------------------------------------- 
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
@@ -138,7 +178,8 @@ nest::aeif_cond_alpha::Parameters_::Parameters_()
     tau_syn_ex (  0.2    ),  // ms
     tau_syn_in (  2.0    ),  // ms
     I_e        (  0.0    ),  // pA
-    gsl_error_tol( 1e-6  )
+    gsl_error_tol( 1e-6  ),
+    native_integrator(false)
 {
 }
 
@@ -190,6 +231,7 @@ void nest::aeif_cond_alpha::Parameters_::get(DictionaryDatum &d) const
   def<double>(d,names::I_e,    I_e);
   def<double>(d,names::V_peak, V_peak_);
   def<double>(d,names::gsl_error_tol, gsl_error_tol);
+  def<bool>(d,names::native_integrator, native_integrator);
 }
 
 void nest::aeif_cond_alpha::Parameters_::set(const DictionaryDatum& d)
@@ -216,6 +258,7 @@ void nest::aeif_cond_alpha::Parameters_::set(const DictionaryDatum& d)
   updateValue<double>(d,names::I_e,    I_e);
 
   updateValue<double>(d,names::gsl_error_tol, gsl_error_tol);
+  updateValue<bool>(d,names::native_integrator, native_integrator);
 
   if ( V_peak_ <= V_th )
     throw BadProperty("V_peak must be larger than threshold.");
@@ -265,17 +308,19 @@ nest::aeif_cond_alpha::Buffers_::Buffers_(aeif_cond_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(1e-6, 0.0, 1e-6)  // tolerances are set in update()
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
-nest::aeif_cond_alpha::Buffers_::Buffers_(const Buffers_&, aeif_cond_alpha& n)
+nest::aeif_cond_alpha::Buffers_::Buffers_(const Buffers_& b, aeif_cond_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(b.solver_)
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -322,9 +367,9 @@ void nest::aeif_cond_alpha::init_state_(const Node& proto)
 
 void nest::aeif_cond_alpha::init_buffers_()
 {
-  B_.spike_exc_.clear();          // includes resize
-  B_.spike_inh_.clear();          // includes resize
-  B_.currents_.clear();           // includes resize
+  B_.spike_exc_.clear(get_buffer_arena_());          // includes resize
+  B_.spike_inh_.clear(get_buffer_arena_());          // includes resize
+  B_.currents_.clear(get_buffer_arena_());           // includes resize
   Archiving_Node::clear_history();
 
   B_.logger_.reset();
@@ -379,12 +424,23 @@ void nest::aeif_cond_alpha::update(Time const & origin, const long_t from, const
   assert ( from < to );
   assert ( State_::V_M == 0 );
 
+  const Parameters_* const p = &P_;
+  const Dynamics_ dynamics = { &p, &B_.I_stim_ };
+
+  // the native solver bounds the absolute error, which dominates the
+  // error bound of the GSL control for the small steps taken here
+  if ( P_.native_integrator )
+    B_.solver_.set_tolerances(P_.gsl_error_tol, 0.0);
+
   for ( long_t lag = from; lag < to; ++lag )
   {
     double t = 0.0;
 
     if ( S_.r_ > 0 )
       --S_.r_;
+
+    if ( P_.native_integrator )
+      B_.solver_.start(1);
  
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
@@ -401,15 +457,24 @@ void nest::aeif_cond_alpha::update(Time const & origin, const long_t from, const
 
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply(B_.e_, B_.c_, B_.s_, 
+      // the native solver performs one step per call, like GSL
+      if ( P_.native_integrator )
+      {
+        B_.solver_.step(dynamics, S_.y_, &B_.IntegrationStep_, B_.step_, 1);
+        t = B_.solver_.get_time(0);
+      }
+      else
+      {
+        const int status = gsl_odeiv_evolve_apply(B_.e_, B_.c_, B_.s_, 
 						&B_.sys_,             // system of ODE
 						&t,                   // from t
 						B_.step_,            // to t <= step
 						&B_.IntegrationStep_, // integration step size
 						S_.y_);              // neuronal state
 
-      if ( status != GSL_SUCCESS )
-        throw GSLSolverFailure(get_name(), status);
+        if ( status != GSL_SUCCESS )
+          throw GSLSolverFailure(get_name(), status);
+      }
       
       // check for unreasonable values; we allow V_M to explode
       if ( S_.y_[State_::V_M] < -1e3 ||
@@ -442,6 +507,105 @@ void nest::aeif_cond_alpha::update(Time const & origin, const long_t from, const
   }
 }
   
+void nest::aeif_cond_alpha::update_population(Node* const* nodes, size_t n,
+                                              Time const & origin, const long_t from, const long_t to)
+{
+  assert ( to >= 0 && (delay) from < Scheduler::get_min_delay() );
+  assert ( from < to );
+
+  typedef State_ S;
+
+  // gather states, step sizes and parameters of all neurons into arrays,
+  // the state variable by variable as required by BatchODESolver
+  std::vector<aeif_cond_alpha*> neurons(n);
+  std::vector<const Parameters_*> P(n);
+  std::vector<double_t> y(S::STATE_VEC_SIZE * n), h(n), I_stim(n);
+  std::vector<int_t> r(n);
+  double_t error_tol = P_.gsl_error_tol;
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    aeif_cond_alpha& nrn = *static_cast<aeif_cond_alpha*>(nodes[i]);
+    assert(nrn.P_.native_integrator);
+    neurons[i] = &nrn;
+    P[i] = &nrn.P_;
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      y[k*n + i] = nrn.S_.y_[k];
+    r[i] = nrn.S_.r_;
+    h[i] = nrn.B_.IntegrationStep_;
+    I_stim[i] = nrn.B_.I_stim_;
+    error_tol = std::min(error_tol, nrn.P_.gsl_error_tol);
+  }
+
+  const Dynamics_ dynamics = { &P[0], &I_stim[0] };
+
+  // the solver of the first neuron serves as work space for all of them
+  BatchODESolver<S::STATE_VEC_SIZE>& solver = neurons[0]->B_.solver_;
+  solver.set_tolerances(error_tol, 0.0);
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+      if ( r[i] > 0 )
+        --r[i];
+
+    // spikes are handled after each round of steps as in update(); the
+    // handling leaves neurons that did not advance in the round unchanged
+    solver.start(n);
+    while ( solver.step(dynamics, &y[0], &h[0], B_.step_, n) )
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        aeif_cond_alpha& nrn = *neurons[i];
+        double_t& V_m = y[S::V_M*n + i];
+        double_t& w = y[S::W*n + i];
+
+        if ( V_m < -1e3 || w < -1e6 || w > 1e6 )
+          throw NumericalInstability(nrn.get_name());
+
+        if ( r[i] > 0 )
+          V_m = nrn.P_.V_reset_;
+        else if ( V_m >= nrn.P_.V_peak_ )
+        {
+          V_m = nrn.P_.V_reset_;
+          w += nrn.P_.b;
+          r[i] = nrn.V_.RefractoryCounts_;
+
+          nrn.set_spiketime(Time::step(origin.get_steps() + lag + 1));
+          SpikeEvent se;
+          network()->send(nrn, se, lag);
+        }
+      }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      aeif_cond_alpha& nrn = *neurons[i];
+
+      y[S::DG_EXC*n + i] += nrn.B_.spike_exc_.get_value(lag) * nrn.V_.g0_ex_;
+      y[S::DG_INH*n + i] += nrn.B_.spike_inh_.get_value(lag) * nrn.V_.g0_in_;
+
+      I_stim[i] = nrn.B_.currents_.get_value(lag);
+
+      // the logger reads the state from the neuron
+      if ( not nrn.B_.logger_.empty() )
+      {
+        for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+          nrn.S_.y_[k] = y[k*n + i];
+        nrn.B_.logger_.record_data(origin.get_steps() + lag);
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    aeif_cond_alpha& nrn = *neurons[i];
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      nrn.S_.y_[k] = y[k*n + i];
+    nrn.S_.r_ = r[i];
+    nrn.B_.IntegrationStep_ = h[i];
+    nrn.B_.I_stim_ = I_stim[i];
+  }
+}
+
 void nest::aeif_cond_alpha::handle(SpikeEvent & e)
 {
   assert(e.get_delay() > 0);
@@ -368,7 +368,7 @@ namespace nest
   {
     B_.spike_exc_.clear();          // includes resize
     B_.spike_inh_.clear();          // includes resize
-    B_.currents_.clear();           // includes resize
+    B_.currents_.clear(get_buffer_arena_());           // includes resize
     Archiving_Node::clear_history();
 
     B_.logger_.reset();
@@ -404,6 +404,11 @@ namespace nest
 
     B_.spike_exc_.resize(P_.num_of_receptors_);
     B_.spike_inh_.resize(P_.num_of_receptors_);
+    for (size_t i = 0; i < P_.num_of_receptors_; ++i)
+    {
+      B_.spike_exc_[i].resize(get_buffer_arena_());
+      B_.spike_inh_[i].resize(get_buffer_arena_());
+    }
     S_.y_.resize(
         State_::NUMBER_OF_FIXED_STATES_ELEMENTS
             + (State_::NUMBER_OF_STATES_ELEMENTS_PER_RECEPTOR
@@ -34,6 +34,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "batch_ode_solver.h"
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_matrix.h>
@@ -97,6 +98,12 @@ Synaptic parameters
 Integration parameters
   gsl_error_tol  double - This parameter controls the admissible error of the GSL integrator.
                           Reduce it if NEST complains about numerical instabilities.
+  native_integrator  bool - If true, integrate with the native Runge-Kutta solver
+                            (Dormand-Prince 5(4)) instead of GSL, with gsl_error_tol
+                            as absolute error bound. If the kernel property
+                            population_update is true, consecutive neurons using it
+                            are integrated together, with the smallest gsl_error_tol
+                            among them (default: false).
 
 Author: Adapted from aeif_cond_alpha by Lyle Muller
 
@@ -162,6 +169,10 @@ namespace nest
     void calibrate();
     void update(const Time &, const long_t, const long_t);
 
+    //! Integrate neurons using the native solver together, see Node::update_population()
+    bool has_population_update() const { return P_.native_integrator; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     // END Boilerplate function declarations ----------------------------
 
     // Friends --------------------------------------------------------
@@ -199,6 +210,7 @@ namespace nest
       double_t I_e;         //!< Intrinsic current in pA.
   
       double_t gsl_error_tol;   //!< error bound for GSL integrator
+      bool     native_integrator; //!< Integrate with BatchODESolver instead of GSL
   
       Parameters_();  //!< Sets default parameter values
 
@@ -273,6 +285,9 @@ namespace nest
       double_t step_;             //!< step size in ms
       double   IntegrationStep_;  //!< current integration time step, updated by GSL
 
+      //! Native solver, used if P_.native_integrator is set
+      BatchODESolver<State_::STATE_VEC_SIZE> solver_;
+
       /** 
        * Input current injected by CurrentEvent.
        * This variable is used to transport the current applied into the
@@ -293,6 +308,18 @@ namespace nest
       int_t RefractoryCounts_;
     };
 
+    /**
+     * Right-hand side of the ODE for the native solver, for any number
+     * of neurons. The members point to one value per neuron.
+     */
+    struct Dynamics_
+    {
+      const Parameters_* const* P;
+      const double_t* I_stim;
+
+      void operator()(const double_t*, double_t*, size_t) const;
+    };
+
     // Access functions for UniversalDataLogger -------------------------------
     
     //! Read out state vector elements, used by UniversalDataLogger
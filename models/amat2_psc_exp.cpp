@@ -225,9 +225,9 @@ namespace nest   // template specialization must be placed in namespace
   {
     Archiving_Node::clear_history();
     
-    B_.spikes_ex_.clear();       // includes resize
-    B_.spikes_in_.clear();       // includes resize
-    B_.currents_.clear();        // includes resize
+    B_.spikes_ex_.clear(get_buffer_arena_());       // includes resize
+    B_.spikes_in_.clear(get_buffer_arena_());       // includes resize
+    B_.currents_.clear(get_buffer_arena_());        // includes resize
 
     B_.logger_.reset();
   }
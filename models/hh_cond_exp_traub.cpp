@@ -39,6 +39,7 @@
 #include <iomanip>
 #include <iostream>
 #include <cstdio>
+#include <vector>
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_matrix.h>
@@ -120,6 +121,51 @@ namespace nest
     return GSL_SUCCESS;
   }
 
+  void nest::hh_cond_exp_traub::Dynamics_::operator()(const double_t* y, double_t* f, size_t n) const
+  {
+    // a shorthand
+    typedef nest::hh_cond_exp_traub::State_ S;
+
+    // same equations as in hh_cond_exp_traub_dynamics, for n neurons
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      const Parameters_& p = *P[i];
+
+      const double V_m   = y[S::V_M   * n + i];
+      const double m     = y[S::HH_M  * n + i];
+      const double h     = y[S::HH_H  * n + i];
+      const double nn    = y[S::HH_N  * n + i];
+      const double g_ex  = y[S::G_EXC * n + i];
+      const double g_in  = y[S::G_INH * n + i];
+
+      const double I_Na =  p.g_Na * m * m * m * h * ( V_m - p.E_Na );
+      const double I_K  =  p.g_K  * nn * nn * nn * nn * ( V_m - p.E_K );
+      const double I_L  =  p.g_L * ( V_m - p.E_L );
+
+      const double I_syn_exc = g_ex * (V_m - p.E_ex);
+      const double I_syn_inh = g_in * (V_m - p.E_in);
+
+      f[S::V_M   * n + i] = ( - I_Na - I_K - I_L - I_syn_exc - I_syn_inh + I_stim[i] + p.I_e )
+        / p.C_m;
+
+      const double V = V_m - p.V_T;
+
+      const double alpha_n = 0.032 * (15.-V) / ( std::exp((15.-V)/5.) - 1.);
+      const double beta_n  = 0.5 * std::exp((10.-V)/40.);
+      const double alpha_m = 0.32 * (13.-V) / ( std::exp((13.-V)/4.) - 1.);
+      const double beta_m  = 0.28 * (V-40.) / ( std::exp((V-40.)/5.) - 1.);
+      const double alpha_h = 0.128 * std::exp((17.-V)/18.);
+      const double beta_h  = 4. / ( 1. + std::exp((40.-V)/5.) );
+
+      f[S::HH_M  * n + i] = alpha_m - ( alpha_m + beta_m ) * m;
+      f[S::HH_H  * n + i] = alpha_h - ( alpha_h + beta_h ) * h;
+      f[S::HH_N  * n + i] = alpha_n - ( alpha_n + beta_n ) * nn;
+
+      f[S::G_EXC * n + i] = -g_ex / p.tau_synE;
+      f[S::G_INH * n + i] = -g_in / p.tau_synI;
+    }
+  }
+
   /* ---------------------------------------------------------------- 
    * Default constructors defining default parameters and state
    * ---------------------------------------------------------------- */
@@ -137,7 +183,8 @@ namespace nest
       E_in		(  -80.0),              
       tau_synE		(    5.0),   // Synaptic Time Constant Excitatory Synapse (ms)		
       tau_synI		(   10.0),   // Synaptic Time Constant Excitatory Synapse (ms)		
-      I_e		(    0.0)    // Stimulus Current (pA)	
+      I_e		(    0.0),   // Stimulus Current (pA)	
+      native_integrator(false)
   {
   }
 
@@ -198,6 +245,7 @@ namespace nest
     def<double_t>(d, names::tau_syn_ex,  tau_synE);
     def<double_t>(d, names::tau_syn_in,  tau_synI);
     def<double_t>(d, names::I_e,       I_e);
+    def<bool>(d, names::native_integrator, native_integrator);
   }
 
   void nest::hh_cond_exp_traub::Parameters_::set(const DictionaryDatum& d)
@@ -215,6 +263,7 @@ namespace nest
     updateValue<double_t>(d, names::tau_syn_ex,  tau_synE);
     updateValue<double_t>(d, names::tau_syn_in,  tau_synI);
     updateValue<double_t>(d, names::I_e,       I_e);
+    updateValue<bool>(d, names::native_integrator, native_integrator);
 
     if ( C_m <= 0 )
       throw BadProperty("Capacitance must be strictly positive.");
@@ -247,17 +296,19 @@ namespace nest
     : logger_(n),
       s_(0),
       c_(0),
-      e_(0)
+      e_(0),
+      solver_(1e-3, 0.0, 1e-6)  // error tolerances as for the GSL solver
   {
     // Initialization of the remaining members is deferred to
     // init_buffers_().
   }
 
-  nest::hh_cond_exp_traub::Buffers_::Buffers_(const Buffers_&, hh_cond_exp_traub& n)
+  nest::hh_cond_exp_traub::Buffers_::Buffers_(const Buffers_& b, hh_cond_exp_traub& n)
     : logger_(n),
       s_(0),
       c_(0),
-      e_(0)
+      e_(0),
+      solver_(b.solver_)
   {
     // Initialization of the remaining members is deferred to
     // init_buffers_().
@@ -304,9 +355,9 @@ namespace nest
 
   void nest::hh_cond_exp_traub::init_buffers_()
   {
-    B_.spike_exc_.clear();          // includes resize
-    B_.spike_inh_.clear();          // includes resize
-    B_.currents_.clear();           // includes resize
+    B_.spike_exc_.clear(get_buffer_arena_());          // includes resize
+    B_.spike_inh_.clear(get_buffer_arena_());          // includes resize
+    B_.currents_.clear(get_buffer_arena_());           // includes resize
     Archiving_Node::clear_history();
 
     B_.logger_.reset();
@@ -355,12 +406,22 @@ namespace nest
     assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
     assert(from < to);
 
+    const Parameters_* const p = &P_;
+    const Dynamics_ dynamics = { &p, &B_.I_stim_ };
+
     for ( long_t lag = from ; lag < to ; ++lag )
       {
     
 	double tt = 0.0 ; //it's all relative!
 	V_.U_old_ = S_.y_[State_::V_M];
 
+	// the native solver integrates over the whole simulation step at once
+	if ( P_.native_integrator )
+	{
+	  B_.solver_.integrate(dynamics, S_.y_, &B_.IntegrationStep_, B_.step_, 1);
+	  tt = B_.step_;
+	}
+
    
 	// adaptive step integration
 	while (tt < B_.step_)
@@ -407,6 +468,92 @@ namespace nest
 
       }
   }
+
+  void nest::hh_cond_exp_traub::update_population(Node* const* nodes, size_t n,
+                                                  Time const & origin,
+                                                  const long_t from, const long_t to)
+  {
+    assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+    assert(from < to);
+
+    typedef State_ S;
+
+    // gather states, step sizes and parameters of all neurons into arrays,
+    // the state variable by variable as required by BatchODESolver
+    std::vector<hh_cond_exp_traub*> neurons(n);
+    std::vector<const Parameters_*> P(n);
+    std::vector<double_t> y(S::STATE_VEC_SIZE * n), h(n), I_stim(n), U_old(n);
+    std::vector<int_t> r(n);
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      hh_cond_exp_traub& nrn = *static_cast<hh_cond_exp_traub*>(nodes[i]);
+      assert(nrn.P_.native_integrator);
+      neurons[i] = &nrn;
+      P[i] = &nrn.P_;
+      for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+        y[k*n + i] = nrn.S_.y_[k];
+      r[i] = nrn.S_.r_;
+      h[i] = nrn.B_.IntegrationStep_;
+      I_stim[i] = nrn.B_.I_stim_;
+    }
+
+    const Dynamics_ dynamics = { &P[0], &I_stim[0] };
+
+    // the solver of the first neuron serves as work space for all of them
+    BatchODESolver<S::STATE_VEC_SIZE>& solver = neurons[0]->B_.solver_;
+
+    for ( long_t lag = from ; lag < to ; ++lag )
+    {
+      for ( size_t i = 0 ; i < n ; ++i )
+        U_old[i] = y[S::V_M*n + i];
+
+      solver.integrate(dynamics, &y[0], &h[0], B_.step_, n);
+
+      // input, refractoriness and spike detection as in update()
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        hh_cond_exp_traub& nrn = *neurons[i];
+        const double_t V_m = y[S::V_M*n + i];
+
+        y[S::G_EXC*n + i] += nrn.B_.spike_exc_.get_value(lag);
+        y[S::G_INH*n + i] += nrn.B_.spike_inh_.get_value(lag);
+
+        if ( r[i] )
+          --r[i];
+        else if ( V_m >= nrn.P_.V_T + 30. && U_old[i] > V_m )
+        {
+          r[i] = nrn.V_.RefractoryCounts_;
+
+          nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+
+          SpikeEvent se;
+          network()->send(nrn, se, lag);
+        }
+
+        I_stim[i] = nrn.B_.currents_.get_value(lag);
+
+        // the logger reads the state from the neuron
+        if ( not nrn.B_.logger_.empty() )
+        {
+          for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+            nrn.S_.y_[k] = y[k*n + i];
+          nrn.B_.logger_.record_data(origin.get_steps() + lag);
+        }
+      }
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      hh_cond_exp_traub& nrn = *neurons[i];
+      for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+        nrn.S_.y_[k] = y[k*n + i];
+      nrn.S_.r_ = r[i];
+      nrn.V_.U_old_ = U_old[i];
+      nrn.B_.IntegrationStep_ = h[i];
+      nrn.B_.I_stim_ = I_stim[i];
+    }
+  }
                        
   void nest::hh_cond_exp_traub::handle(SpikeEvent & e)
   {
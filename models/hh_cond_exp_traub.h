@@ -34,6 +34,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "batch_ode_solver.h"
 
 #include <gsl/gsl_odeiv.h>
 
@@ -91,6 +92,10 @@ Parameters:
   E_K        double - Potassium reversal potential in mV.
   g_K        double - Potassium peak conductance in nS.
   I_e        double - External input current in pA.
+  native_integrator  bool - If true, integrate with the native Runge-Kutta solver
+                            (Dormand-Prince 5(4)) instead of GSL. If the kernel
+                            property population_update is true, consecutive
+                            neurons using it are integrated together (default: false).
   
 References:
   
@@ -145,6 +150,10 @@ SeeAlso: hh_psc_alpha
     
     void update(Time const &, const long_t, const long_t);
 
+    //! Integrate neurons using the native solver together, see Node::update_population()
+    bool has_population_update() const { return P_.native_integrator; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     // END Boilerplate function declarations ----------------------------
 
     // Friends --------------------------------------------------------
@@ -180,6 +189,7 @@ SeeAlso: hh_psc_alpha
       double tau_synE;		        //!< Synaptic Time Constant Excitatory Synapse in ms
       double tau_synI;		        //!< Synaptic Time Constant Inhibitory Synapse in ms
       double I_e;			//!< External Current in pA
+      bool   native_integrator;         //!< Integrate with BatchODESolver instead of GSL
 
       Parameters_();
       
@@ -258,6 +268,9 @@ SeeAlso: hh_psc_alpha
       double_t step_;           //!< step size in ms
       double   IntegrationStep_;//!< current integration time step, updated by GSL
 
+      //! Native solver, used if P_.native_integrator is set
+      BatchODESolver<State_::STATE_VEC_SIZE> solver_;
+
       /** 
        * Input current injected by CurrentEvent.
        * This variable is used to transport the current applied into the
@@ -268,6 +281,17 @@ SeeAlso: hh_psc_alpha
       double_t I_stim_;
     };
 
+    /**
+     * Right-hand side of the ODE for the native solver, for any number
+     * of neurons. The members point to one value per neuron.
+     */
+    struct Dynamics_ {
+      const Parameters_* const* P;
+      const double_t* I_stim;
+
+      void operator()(const double_t*, double_t*, size_t) const;
+    };
+
     // Access functions for UniversalDataLogger -------------------------------
     
     //! Read out state vector elements, used by UniversalDataLogger
@@ -38,6 +38,7 @@
 #include <iomanip>
 #include <iostream>
 #include <cstdio>
+#include <vector>
 
 
 nest::RecordablesMap<nest::hh_psc_alpha> nest::hh_psc_alpha::recordablesMap_;
@@ -119,6 +120,49 @@ namespace nest
   }
 }
 
+void nest::hh_psc_alpha::Dynamics_::operator()(const double_t* y, double_t* f, size_t n) const
+{
+  // a shorthand
+  typedef nest::hh_psc_alpha::State_ S;
+
+  // same equations as in hh_psc_alpha_dynamics, for n neurons
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    const Parameters_& p = *P[i];
+
+    const double_t V     = y[S::V_M    * n + i];
+    const double_t m     = y[S::HH_M   * n + i];
+    const double_t h     = y[S::HH_H   * n + i];
+    const double_t nn    = y[S::HH_N   * n + i];
+    const double_t dI_ex = y[S::DI_EXC * n + i];
+    const double_t  I_ex = y[S::I_EXC  * n + i];
+    const double_t dI_in = y[S::DI_INH * n + i];
+    const double_t  I_in = y[S::I_INH  * n + i];
+
+    const double_t alpha_n = (0.01 * (V+55.)) / (1. -std::exp( -(V+55.)/10.));
+    const double_t beta_n  = 0.125 * std::exp( -(V+65.)/80.);
+    const double_t alpha_m = (0.1 * (V+40.)) / (1. - std::exp( -(V+40.)/10.) );
+    const double_t beta_m  = 4. * std::exp( -(V+65.)/18.);
+    const double_t alpha_h = 0.07 * std::exp( -(V+65.) / 20.);
+    const double_t beta_h  = 1. / (1. + std::exp(-(V+35.) / 10. ));
+
+    const double_t I_Na = p.g_Na * m * m * m * h * (V - p.E_Na);
+    const double_t I_K  = p.g_K  * nn * nn * nn * nn * (V - p.E_K );
+    const double_t I_L  = p.g_L                  * (V - p.E_L );
+
+    f[S::V_M    * n + i] = ( -(I_Na + I_K + I_L) + I_stim[i] + p.I_e + I_ex + I_in) / p.C_m;
+
+    f[S::HH_M   * n + i] = alpha_m * (1-m) - beta_m * m;
+    f[S::HH_H   * n + i] = alpha_h * (1-h) - beta_h * h;
+    f[S::HH_N   * n + i] = alpha_n * (1-nn) - beta_n * nn;
+
+    f[S::DI_EXC * n + i] = -dI_ex / p.tau_synE;
+    f[S::I_EXC  * n + i] =  dI_ex  - (I_ex / p.tau_synE);
+    f[S::DI_INH * n + i] = -dI_in / p.tau_synI;
+    f[S::I_INH  * n + i] =  dI_in  - (I_in / p.tau_synI);
+  }
+}
+
 /* ---------------------------------------------------------------- 
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
@@ -134,7 +178,8 @@ nest::hh_psc_alpha::Parameters_::Parameters_()
     E_L     (  -54.402),  // mV
     tau_synE(  0.2    ),  // ms
     tau_synI(  2.0    ),  // ms
-    I_e     (  0.0    )   // pA
+    I_e     (  0.0    ),  // pA
+    native_integrator(false)
 {
 }
 
@@ -192,6 +237,7 @@ void nest::hh_psc_alpha::Parameters_::get(DictionaryDatum &d) const
   def<double>(d,names::tau_syn_ex, tau_synE);
   def<double>(d,names::tau_syn_in, tau_synI);
   def<double>(d,names::I_e, I_e);
+  def<bool>(d,names::native_integrator, native_integrator);
 }
 
 void nest::hh_psc_alpha::Parameters_::set(const DictionaryDatum& d)
@@ -209,6 +255,7 @@ void nest::hh_psc_alpha::Parameters_::set(const DictionaryDatum& d)
   updateValue<double>(d,names::tau_syn_in,tau_synI);
 
   updateValue<double>(d,names::I_e, I_e);
+  updateValue<bool>(d,names::native_integrator, native_integrator);
 
   if ( C_m <= 0 )
     throw BadProperty("Capacitance must be strictly positive.");
@@ -246,17 +293,19 @@ nest::hh_psc_alpha::Buffers_::Buffers_(hh_psc_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(1e-3, 0.0, 1e-6)  // error tolerances as for the GSL solver
 {
     // Initialization of the remaining members is deferred to
     // init_buffers_().
 }
 
-nest::hh_psc_alpha::Buffers_::Buffers_(const Buffers_&, hh_psc_alpha& n)
+nest::hh_psc_alpha::Buffers_::Buffers_(const Buffers_& b, hh_psc_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(b.solver_)
 {
     // Initialization of the remaining members is deferred to
     // init_buffers_().
@@ -303,9 +352,9 @@ void nest::hh_psc_alpha::init_state_(const Node& proto)
 
 void nest::hh_psc_alpha::init_buffers_()
 {
-  B_.spike_exc_.clear();       // includes resize
-  B_.spike_inh_.clear();       // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.spike_exc_.clear(get_buffer_arena_());       // includes resize
+  B_.spike_inh_.clear(get_buffer_arena_());       // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
   Archiving_Node::clear_history();
 
   B_.logger_.reset();
@@ -358,12 +407,22 @@ void nest::hh_psc_alpha::update(Time const & origin, const long_t from, const lo
   assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
   assert(from < to);
 
+  const Parameters_* const p = &P_;
+  const Dynamics_ dynamics = { &p, &B_.I_stim_ };
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     
     double_t       t = 0.0 ;
     const double_t U_old = S_.y_[State_::V_M];
 
+    // the native solver integrates over the whole simulation step at once
+    if ( P_.native_integrator )
+    {
+      B_.solver_.integrate(dynamics, S_.y_, &B_.IntegrationStep_, B_.step_, 1);
+      t = B_.step_;
+    }
+
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
     // gsl_odeiv_evolve_apply performs only a single numerical
@@ -417,6 +476,90 @@ void nest::hh_psc_alpha::update(Time const & origin, const long_t from, const lo
   }
 }
 
+void nest::hh_psc_alpha::update_population(Node* const* nodes, size_t n,
+                                           Time const & origin, const long_t from, const long_t to)
+{
+  assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+  assert(from < to);
+
+  typedef State_ S;
+
+  // gather states, step sizes and parameters of all neurons into arrays,
+  // the state variable by variable as required by BatchODESolver
+  std::vector<hh_psc_alpha*> neurons(n);
+  std::vector<const Parameters_*> P(n);
+  std::vector<double_t> y(S::STATE_VEC_SIZE * n), h(n), I_stim(n), U_old(n);
+  std::vector<int_t> r(n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    hh_psc_alpha& nrn = *static_cast<hh_psc_alpha*>(nodes[i]);
+    assert(nrn.P_.native_integrator);
+    neurons[i] = &nrn;
+    P[i] = &nrn.P_;
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      y[k*n + i] = nrn.S_.y_[k];
+    r[i] = nrn.S_.r_;
+    h[i] = nrn.B_.IntegrationStep_;
+    I_stim[i] = nrn.B_.I_stim_;
+  }
+
+  const Dynamics_ dynamics = { &P[0], &I_stim[0] };
+
+  // the solver of the first neuron serves as work space for all of them
+  BatchODESolver<S::STATE_VEC_SIZE>& solver = neurons[0]->B_.solver_;
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+      U_old[i] = y[S::V_M*n + i];
+
+    solver.integrate(dynamics, &y[0], &h[0], B_.step_, n);
+
+    // input, refractoriness and spike detection as in update()
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      hh_psc_alpha& nrn = *neurons[i];
+      const double_t V_m = y[S::V_M*n + i];
+
+      y[S::DI_EXC*n + i] += nrn.B_.spike_exc_.get_value(lag) * nrn.V_.PSCurrInit_E_;
+      y[S::DI_INH*n + i] += nrn.B_.spike_inh_.get_value(lag) * nrn.V_.PSCurrInit_I_;
+
+      if ( r[i] > 0 )
+        --r[i];
+      else if ( V_m >= 0 && U_old[i] > V_m )
+      {
+        r[i] = nrn.V_.RefractoryCounts_;
+
+        nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+
+        SpikeEvent se;
+        network()->send(nrn, se, lag);
+      }
+
+      // the logger reads the state from the neuron
+      if ( not nrn.B_.logger_.empty() )
+      {
+        for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+          nrn.S_.y_[k] = y[k*n + i];
+        nrn.B_.logger_.record_data(origin.get_steps() + lag);
+      }
+
+      I_stim[i] = nrn.B_.currents_.get_value(lag);
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    hh_psc_alpha& nrn = *neurons[i];
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      nrn.S_.y_[k] = y[k*n + i];
+    nrn.S_.r_ = r[i];
+    nrn.B_.IntegrationStep_ = h[i];
+    nrn.B_.I_stim_ = I_stim[i];
+  }
+}
+
 void nest::hh_psc_alpha::handle(SpikeEvent & e)
 {
   assert(e.get_delay() > 0);
@@ -27,6 +27,7 @@
 #include "universal_data_logger_impl.h"
 
 #include <cmath>
+#include <vector>
 
 namespace nest{
   
@@ -163,6 +164,83 @@ namespace nest{
 
     return GSL_SUCCESS;
   }
+
+  void ht_neuron::Dynamics_::operator()(const double_t* y, double_t* f, size_t n) const
+  {
+    // shorthand
+    typedef nest::ht_neuron::State_ S;
+
+    // same equations as in ht_neuron_dynamics, for n neurons
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      ht_neuron& node = *nodes[i];
+      const Parameters_& p = node.P_;
+
+      const double_t V = y[S::VM * n + i];
+
+      double_t I_syn = 0;
+      I_syn += - y[S::G_AMPA * n + i] * (V - p.AMPA_E_rev);
+      I_syn += - y[S::G_NMDA * n + i] * (V - p.NMDA_E_rev)
+        / ( 1 + std::exp((p.NMDA_Vact - V) / p.NMDA_Sact) );
+      I_syn += - y[S::G_GABA_A * n + i] * (V - p.GABA_A_E_rev);
+      I_syn += - y[S::G_GABA_B * n + i] * (V - p.GABA_B_E_rev);
+
+      const double_t I_spike = node.S_.g_spike_ ? - (V - p.E_K) / p.Tau_spike : 0;
+
+      const double_t I_Na = - p.g_NaL*(V - p.E_Na);
+      const double_t I_K  = - p.g_KL*(V - p.E_K);
+
+      const double_t INaP_thresh = -55.7;
+      const double_t INaP_slope = 7.7;
+      const double_t m_inf_NaP = 1.0 / (1.0 + std::exp(-(V- INaP_thresh)/INaP_slope));
+      node.S_.I_NaP_ = - p.NaP_g_peak * std::pow(m_inf_NaP, 3.0) * (V - p.NaP_E_rev);
+
+      const double_t d_half = 0.25;
+      const double_t m_inf_KNa = 1.0 / (1.0 + std::pow(d_half/y[S::IKNa_D * n + i], 3.5));
+      node.S_.I_KNa_ = - p.KNa_g_peak * m_inf_KNa * (V - p.KNa_E_rev);
+
+      const double_t m_inf_T = 1.0/(1.0 + std::exp(-(V+59.0)/6.2));
+      const double_t h_inf_T = 1.0/(1.0 + std::exp((V + 83.0)/4));
+      node.S_.I_T_ = - p.T_g_peak * y[S::IT_m * n + i] * y[S::IT_m * n + i]
+        * y[S::IT_h * n + i] * (V - p.T_E_rev);
+
+      const double_t I_h_Vthreshold = -75.0;
+      const double_t m_inf_h = 1.0/(1.0 + std::exp((V - I_h_Vthreshold)/5.5));
+      node.S_.I_h_ = - p.h_g_peak * y[S::Ih_m * n + i] * (V - p.h_E_rev);
+
+      f[S::VM * n + i] = (I_Na + I_K + I_syn + node.S_.I_NaP_ + node.S_.I_KNa_ + node.S_.I_T_
+                          + node.S_.I_h_ + node.B_.I_stim_)/p.Tau_m + I_spike;
+
+      f[S::THETA * n + i] = -(y[S::THETA * n + i] - p.Theta_eq)/p.Tau_theta;
+
+      f[S::DG_AMPA * n + i] = -y[S::DG_AMPA * n + i]/p.AMPA_Tau_1;
+      f[S::G_AMPA * n + i] = y[S::DG_AMPA * n + i] - y[S::G_AMPA * n + i]/p.AMPA_Tau_2;
+
+      f[S::DG_NMDA * n + i] = -y[S::DG_NMDA * n + i]/p.NMDA_Tau_1;
+      f[S::G_NMDA * n + i] = y[S::DG_NMDA * n + i] - y[S::G_NMDA * n + i]/p.NMDA_Tau_2;
+
+      f[S::DG_GABA_A * n + i] = -y[S::DG_GABA_A * n + i]/p.GABA_A_Tau_1;
+      f[S::G_GABA_A * n + i] = y[S::DG_GABA_A * n + i] - y[S::G_GABA_A * n + i]/p.GABA_A_Tau_2;
+
+      f[S::DG_GABA_B * n + i] = -y[S::DG_GABA_B * n + i]/p.GABA_B_Tau_1;
+      f[S::G_GABA_B * n + i] = y[S::DG_GABA_B * n + i] - y[S::G_GABA_B * n + i]/p.GABA_B_Tau_2;
+
+      const double_t D_influx_peak = 0.025;
+      const double_t tau_D = 1250.0;
+      const double_t D_thresh = -10.0;
+      const double_t D_slope = 5.0;
+      const double_t D_influx = 1.0/(1.0 + std::exp(-(V-D_thresh)/D_slope));
+      f[S::IKNa_D * n + i] = D_influx_peak * D_influx - (y[S::IKNa_D * n + i]-KNa_D_EQ)/tau_D;
+
+      const double_t tau_m_T = 0.22/(std::exp(-(V + 132.0)/16.7)+std::exp((V + 16.8)/18.2)) + 0.13;
+      const double_t tau_h_T = 8.2 + (56.6 + 0.27 * std::exp((V + 115.2)/5.0))/(1.0 + std::exp((V + 86.0)/3.2));
+      f[S::IT_m * n + i] = (m_inf_T - y[S::IT_m * n + i]) / tau_m_T;
+      f[S::IT_h * n + i] = (h_inf_T - y[S::IT_h * n + i]) / tau_h_T;
+
+      const double_t tau_m_h = 1.0/(std::exp(-14.59 - 0.086 * V) + std::exp(-1.87 + 0.0701 * V));
+      f[S::Ih_m * n + i] = (m_inf_h - y[S::Ih_m * n + i]) / tau_m_h;
+    }
+  }
  
   /* ---------------------------------------------------------------- 
    * Default constructors defining default parameters and state
@@ -203,7 +281,8 @@ namespace nest{
       T_g_peak       (  1.0 ),
       T_E_rev        (  0.0 ), // mV
       h_g_peak       (  1.0 ),
-      h_E_rev        (-40.0 )  // mV
+      h_E_rev        (-40.0 ), // mV
+      native_integrator(false)
   {}
 
   nest::ht_neuron::State_::State_()
@@ -313,6 +392,7 @@ namespace nest{
     def<double_t>(d, "T_E_rev",       T_E_rev);
     def<double_t>(d, "h_g_peak",      h_g_peak);
     def<double_t>(d, "h_E_rev",       h_E_rev);
+    def<bool>(d, names::native_integrator, native_integrator);
   } 
 
   void nest::ht_neuron::Parameters_::set(const DictionaryDatum& d)
@@ -352,6 +432,7 @@ namespace nest{
     updateValue<double_t>(d, "T_E_rev",       T_E_rev);
     updateValue<double_t>(d, "h_g_peak",      h_g_peak);
     updateValue<double_t>(d, "h_E_rev",       h_E_rev);
+    updateValue<bool>(d, names::native_integrator, native_integrator);
   }
 
   void nest::ht_neuron::State_::get(DictionaryDatum &d) const
@@ -372,18 +453,20 @@ namespace nest{
       spike_inputs_(std::vector<RingBuffer>(SUP_SPIKE_RECEPTOR-1)),
       s_(0),
       c_(0),
-      e_(0)
+      e_(0),
+      solver_(1e-3, 0.0, 1e-6)  // error tolerances as for the GSL solver
   {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
   }
 
-  nest::ht_neuron::Buffers_::Buffers_(const Buffers_&, ht_neuron& n)
+  nest::ht_neuron::Buffers_::Buffers_(const Buffers_& b, ht_neuron& n)
     : logger_(n),
       spike_inputs_(std::vector<RingBuffer>(SUP_SPIKE_RECEPTOR-1)),
       s_(0),
       c_(0),
-      e_(0)
+      e_(0),
+      solver_(b.solver_)
   {
     // Initialization of the remaining members is deferred to
     // init_buffers_().
@@ -433,10 +516,10 @@ namespace nest{
     for(std::vector<RingBuffer>::iterator it = B_.spike_inputs_.begin();
 	it != B_.spike_inputs_.end(); ++it)
       {
-	it->clear(); // include resize
+	it->clear(get_buffer_arena_()); // include resize
       }
 
-    B_.currents_.clear();  // include resize
+    B_.currents_.clear(get_buffer_arena_());  // include resize
 
     B_.logger_.reset();
 
@@ -556,10 +639,20 @@ namespace nest{
   {
     assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
     assert(from < to);
+
+    ht_neuron* const self = this;
+    const Dynamics_ dynamics = { &self };
     
     for ( long_t lag = from ; lag < to ; ++lag )
       {
 	double tt = 0.0; // it's all relative!
+
+	// the native solver integrates over the whole simulation step at once
+	if ( P_.native_integrator )
+	{
+	  B_.solver_.integrate(dynamics, S_.y_, &B_.IntegrationStep_, B_.step_, 1);
+	  tt = B_.step_;
+	}
 	
 	// adaptive step integration
 	while ( tt < B_.step_ )
@@ -609,6 +702,85 @@ namespace nest{
 	B_.logger_.record_data(origin.get_steps()+lag);
       }
   }
+
+  void ht_neuron::update_population(Node* const* nodes, size_t n,
+                                    Time const & origin, const long_t from, const long_t to)
+  {
+    assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+    assert(from < to);
+
+    typedef State_ S;
+
+    // gather states and step sizes of all neurons into arrays, the state
+    // variable by variable as required by BatchODESolver; the dynamics
+    // read everything else from the neurons
+    std::vector<ht_neuron*> neurons(n);
+    std::vector<double_t> y(S::STATE_VEC_SIZE * n), h(n);
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      ht_neuron& nrn = *static_cast<ht_neuron*>(nodes[i]);
+      assert(nrn.P_.native_integrator);
+      neurons[i] = &nrn;
+      for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+        y[k*n + i] = nrn.S_.y_[k];
+      h[i] = nrn.B_.IntegrationStep_;
+    }
+
+    const Dynamics_ dynamics = { &neurons[0] };
+
+    // the solver of the first neuron serves as work space for all of them
+    BatchODESolver<S::STATE_VEC_SIZE>& solver = neurons[0]->B_.solver_;
+
+    for ( long_t lag = from ; lag < to ; ++lag )
+    {
+      solver.integrate(dynamics, &y[0], &h[0], B_.step_, n);
+
+      // potassium current, input and spike generation as in update()
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        ht_neuron& nrn = *neurons[i];
+
+        if( nrn.S_.r_potassium_ && --nrn.S_.r_potassium_ == 0 )
+          nrn.S_.g_spike_ = false;
+
+        for ( size_t j = 0 ; j < nrn.B_.spike_inputs_.size() ; ++j )
+          y[(2+2*j)*n + i] += nrn.V_.cond_steps_[j] * nrn.B_.spike_inputs_[j].get_value(lag);
+
+        if( !nrn.S_.g_spike_ && y[S::VM*n + i] >= y[S::THETA*n + i] )
+        {
+          y[S::VM*n + i] = nrn.P_.E_Na;
+          y[S::THETA*n + i] = nrn.P_.E_Na;
+
+          nrn.S_.g_spike_ = nrn.V_.PotassiumRefractoryCounts_ > 0;
+          nrn.S_.r_potassium_ = nrn.V_.PotassiumRefractoryCounts_;
+
+          nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+
+          SpikeEvent se;
+          network()->send(nrn, se, lag);
+        }
+
+        nrn.B_.I_stim_ = nrn.B_.currents_.get_value(lag);
+
+        // the logger reads the state from the neuron
+        if ( not nrn.B_.logger_.empty() )
+        {
+          for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+            nrn.S_.y_[k] = y[k*n + i];
+          nrn.B_.logger_.record_data(origin.get_steps()+lag);
+        }
+      }
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      ht_neuron& nrn = *neurons[i];
+      for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+        nrn.S_.y_[k] = y[k*n + i];
+      nrn.B_.IntegrationStep_ = h[i];
+    }
+  }
   
   void nest::ht_neuron::handle(SpikeEvent & e)
   {
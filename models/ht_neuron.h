@@ -34,6 +34,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "batch_ode_solver.h"
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_matrix.h>
@@ -93,6 +94,11 @@
 
    {h,T,NaP,KNa}_{E_rev,g_peak} - reversal potential and peak conductance for intrinsic currents
 
+   native_integrator - If true, integrate with the native Runge-Kutta solver
+                       (Dormand-Prince 5(4)) instead of GSL. If the kernel property
+                       population_update is true, consecutive neurons using it are
+                       integrated together (default: false).
+
    receptor_types - dictionary mapping synapse names to ports on neuron model
    recordables - list of recordable quantities.
 
@@ -168,6 +174,10 @@ namespace nest{
     
     void update(Time const &, const long_t, const long_t);
 
+    //! Integrate neurons using the native solver together, see Node::update_population()
+    bool has_population_update() const { return P_.native_integrator; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     double_t get_synapse_constant(double_t, double_t, double_t);
 
     // END Boilerplate function declarations ----------------------------
@@ -238,6 +248,8 @@ namespace nest{
 
       double_t h_g_peak;   
       double_t h_E_rev;    // mV
+
+      bool native_integrator; //!< Integrate with BatchODESolver instead of GSL
     };
 
     // ---------------------------------------------------------------- 
@@ -317,6 +329,9 @@ namespace nest{
       double_t step_;           //!< step size in ms
       double   IntegrationStep_;//!< current integration time step, updated by GSL
 
+      //! Native solver, used if P_.native_integrator is set
+      BatchODESolver<State_::STATE_VEC_SIZE> solver_;
+
       /** 
        * Input current injected by CurrentEvent.
        * This variable is used to transport the current applied into the
@@ -340,6 +355,18 @@ namespace nest{
       int_t    PotassiumRefractoryCounts_;
     };
 
+    /**
+     * Right-hand side of the ODE for the native solver, for any number
+     * of neurons. As ht_neuron_dynamics, it reads the parameters, spike
+     * current state and input current from the neurons and stores the
+     * intrinsic currents there for recording.
+     */
+    struct Dynamics_ {
+      ht_neuron* const* nodes;
+
+      void operator()(const double_t*, double_t*, size_t) const;
+    };
+
 
     // readout functions, can use template for vector elements
     template <State_::StateVecElems_ elem>
@@ -174,8 +174,8 @@ void nest::iaf_chs_2007::init_state_(const Node &proto)
 
 void nest::iaf_chs_2007::init_buffers_()
 {
-  B_.spikes_ex_.clear();        // includes resize
-  B_.currents_.clear();         // includes resize
+  B_.spikes_ex_.clear(get_buffer_arena_());        // includes resize
+  B_.currents_.clear(get_buffer_arena_());         // includes resize
   B_.logger_.reset();
   Archiving_Node::clear_history();
 }
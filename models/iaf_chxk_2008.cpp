@@ -259,9 +259,9 @@ void nest::iaf_chxk_2008::init_state_(const Node& proto) {
 void nest::iaf_chxk_2008::init_buffers_() {
 	Archiving_Node::clear_history();
 
-	B_.spike_exc_.clear(); // includes resize
-	B_.spike_inh_.clear(); // includes resize
-	B_.currents_.clear(); // includes resize
+	B_.spike_exc_.clear(get_buffer_arena_()); // includes resize
+	B_.spike_inh_.clear(get_buffer_arena_()); // includes resize
+	B_.currents_.clear(get_buffer_arena_()); // includes resize
 
 	B_.logger_.reset();
 
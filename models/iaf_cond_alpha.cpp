@@ -38,6 +38,7 @@
 #include <iomanip>
 #include <iostream>
 #include <cstdio>
+#include <vector>
 
 /* ---------------------------------------------------------------- 
  * Recordables map
@@ -104,6 +105,34 @@ inline int nest::iaf_cond_alpha_dynamics(double, const double y[], double f[], v
   return GSL_SUCCESS;
  }
 
+void nest::iaf_cond_alpha::Dynamics_::operator()(const double_t* y, double_t* f, size_t n) const
+{
+  // a shorthand
+  typedef nest::iaf_cond_alpha::State_ S;
+
+  // same equations as in iaf_cond_alpha_dynamics, for n neurons
+  const double_t* V_m = y + S::V_M * n;
+  const double_t* dg_ex = y + S::DG_EXC * n;
+  const double_t* g_ex = y + S::G_EXC * n;
+  const double_t* dg_in = y + S::DG_INH * n;
+  const double_t* g_in = y + S::G_INH * n;
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    const double_t I_syn_exc = g_ex[i] * ( V_m[i] - E_ex[i] );
+    const double_t I_syn_inh = g_in[i] * ( V_m[i] - E_in[i] );
+    const double_t I_leak    = g_L[i] * ( V_m[i] - E_L[i]  );
+
+    f[S::V_M * n + i] = ( - I_leak - I_syn_exc - I_syn_inh + I_stim[i] + I_e[i] ) / C_m[i];
+
+    f[S::DG_EXC * n + i] = -dg_ex[i] / tau_synE[i];
+    f[S::G_EXC * n + i] = dg_ex[i] - (g_ex[i]/tau_synE[i]);
+
+    f[S::DG_INH * n + i] = -dg_in[i] / tau_synI[i];
+    f[S::G_INH * n + i] = dg_in[i] - (g_in[i]/tau_synI[i]);
+  }
+}
+
 /* ---------------------------------------------------------------- 
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
@@ -119,7 +148,8 @@ nest::iaf_cond_alpha::Parameters_::Parameters_()
     E_L     (-70.0    ),  // mV
     tau_synE(  0.2    ),  // ms
     tau_synI(  2.0    ),  // ms
-    I_e     (  0.0    )   // pA
+    I_e     (  0.0    ),  // pA
+    native_integrator(false)
 {
 }
 
@@ -154,17 +184,19 @@ nest::iaf_cond_alpha::Buffers_::Buffers_(iaf_cond_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(1e-3, 0.0, 1e-6)  // error tolerances as for the GSL solver
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
-nest::iaf_cond_alpha::Buffers_::Buffers_(const Buffers_&, iaf_cond_alpha& n)
+nest::iaf_cond_alpha::Buffers_::Buffers_(const Buffers_& b, iaf_cond_alpha& n)
   : logger_(n),
     s_(0),
     c_(0),
-    e_(0)
+    e_(0),
+    solver_(b.solver_)
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -187,6 +219,7 @@ void nest::iaf_cond_alpha::Parameters_::get(DictionaryDatum &d) const
   def<double>(d,names::tau_syn_ex,   tau_synE);
   def<double>(d,names::tau_syn_in,   tau_synI);
   def<double>(d,names::I_e,          I_e);
+  def<bool>(d,names::native_integrator, native_integrator);
 }
 
 void nest::iaf_cond_alpha::Parameters_::set(const DictionaryDatum& d)
@@ -207,6 +240,7 @@ void nest::iaf_cond_alpha::Parameters_::set(const DictionaryDatum& d)
   updateValue<double>(d,names::tau_syn_in, tau_synI);
 
   updateValue<double>(d,names::I_e,     I_e);
+  updateValue<bool>(d,names::native_integrator, native_integrator);
 
   if ( V_reset >= V_th )
     throw BadProperty("Reset potential must be smaller than threshold.");
@@ -275,9 +309,9 @@ void nest::iaf_cond_alpha::init_buffers_()
 {
   Archiving_Node::clear_history();
 
-  B_.spike_exc_.clear();       // includes resize
-  B_.spike_inh_.clear();       // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.spike_exc_.clear(get_buffer_arena_());       // includes resize
+  B_.spike_inh_.clear(get_buffer_arena_());       // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
 
   B_.logger_.reset();
 
@@ -330,11 +364,21 @@ void nest::iaf_cond_alpha::update(Time const & origin, const long_t from, const
   assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
   assert(from < to);
 
+  const Dynamics_ dynamics = { &P_.g_L, &P_.C_m, &P_.E_ex, &P_.E_in, &P_.E_L,
+                               &P_.tau_synE, &P_.tau_synI, &P_.I_e, &B_.I_stim_ };
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     
     double t = 0.0;
 
+    // the native solver integrates over the whole simulation step at once
+    if ( P_.native_integrator )
+    {
+      B_.solver_.integrate(dynamics, S_.y, &B_.IntegrationStep_, B_.step_, 1);
+      t = B_.step_;
+    }
+
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
     // gsl_odeiv_evolve_apply performs only a single numerical
@@ -393,6 +437,99 @@ void nest::iaf_cond_alpha::update(Time const & origin, const long_t from, const
   }
 }
 
+void nest::iaf_cond_alpha::update_population(Node* const* nodes, size_t n,
+                                             Time const & origin, const long_t from, const long_t to)
+{
+  assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+  assert(from < to);
+
+  typedef State_ S;
+
+  // gather states, step sizes and parameters of all neurons into arrays,
+  // the state variable by variable as required by BatchODESolver
+  std::vector<iaf_cond_alpha*> neurons(n);
+  std::vector<double_t> y(S::STATE_VEC_SIZE * n), h(n), I_stim(n);
+  std::vector<double_t> g_L(n), C_m(n), E_ex(n), E_in(n), E_L(n), tau_synE(n), tau_synI(n), I_e(n);
+  std::vector<int_t> r(n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_cond_alpha& nrn = *static_cast<iaf_cond_alpha*>(nodes[i]);
+    assert(nrn.P_.native_integrator);
+    neurons[i] = &nrn;
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      y[k*n + i] = nrn.S_.y[k];
+    r[i] = nrn.S_.r;
+    h[i] = nrn.B_.IntegrationStep_;
+    I_stim[i] = nrn.B_.I_stim_;
+    g_L[i] = nrn.P_.g_L;
+    C_m[i] = nrn.P_.C_m;
+    E_ex[i] = nrn.P_.E_ex;
+    E_in[i] = nrn.P_.E_in;
+    E_L[i] = nrn.P_.E_L;
+    tau_synE[i] = nrn.P_.tau_synE;
+    tau_synI[i] = nrn.P_.tau_synI;
+    I_e[i] = nrn.P_.I_e;
+  }
+
+  const Dynamics_ dynamics = { &g_L[0], &C_m[0], &E_ex[0], &E_in[0], &E_L[0],
+                               &tau_synE[0], &tau_synI[0], &I_e[0], &I_stim[0] };
+
+  // the solver of the first neuron serves as work space for all of them
+  BatchODESolver<S::STATE_VEC_SIZE>& solver = neurons[0]->B_.solver_;
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    solver.integrate(dynamics, &y[0], &h[0], B_.step_, n);
+
+    // refractoriness, spike generation and input as in update()
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      iaf_cond_alpha& nrn = *neurons[i];
+      double_t& V_m = y[S::V_M*n + i];
+
+      if ( r[i] )
+      {
+        --r[i];
+        V_m = nrn.P_.V_reset;
+      }
+      else if ( V_m >= nrn.P_.V_th )
+      {
+        r[i] = nrn.V_.RefractoryCounts;
+        V_m = nrn.P_.V_reset;
+
+        nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+
+        SpikeEvent se;
+        network()->send(nrn, se, lag);
+      }
+
+      y[S::DG_EXC*n + i] += nrn.B_.spike_exc_.get_value(lag) * nrn.V_.PSConInit_E;
+      y[S::DG_INH*n + i] += nrn.B_.spike_inh_.get_value(lag) * nrn.V_.PSConInit_I;
+
+      I_stim[i] = nrn.B_.currents_.get_value(lag);
+
+      // the logger reads the state from the neuron
+      if ( not nrn.B_.logger_.empty() )
+      {
+        for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+          nrn.S_.y[k] = y[k*n + i];
+        nrn.B_.logger_.record_data(origin.get_steps() + lag);
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_cond_alpha& nrn = *neurons[i];
+    for ( size_t k = 0 ; k < S::STATE_VEC_SIZE ; ++k )
+      nrn.S_.y[k] = y[k*n + i];
+    nrn.S_.r = r[i];
+    nrn.B_.IntegrationStep_ = h[i];
+    nrn.B_.I_stim_ = I_stim[i];
+  }
+}
+
 void nest::iaf_cond_alpha::handle(SpikeEvent & e)
 {
   assert(e.get_delay() > 0);
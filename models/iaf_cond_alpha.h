@@ -34,6 +34,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "batch_ode_solver.h"
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_matrix.h>
@@ -64,6 +65,10 @@ g_L        double - Leak conductance in nS;
 tau_syn_ex double - Rise time of the excitatory synaptic alpha function in ms.
 tau_syn_in double - Rise time of the inhibitory synaptic alpha function in ms.
 I_e        double - Constant input current in pA.
+native_integrator  bool - If true, integrate with the native Runge-Kutta solver
+                          (Dormand-Prince 5(4)) instead of GSL. If the kernel
+                          property population_update is true, consecutive
+                          neurons using it are integrated together (default: false).
 
 Sends: SpikeEvent
 
@@ -152,6 +157,10 @@ namespace nest
     void calibrate();
     void update(Time const &, const long_t, const long_t);
 
+    //! Integrate neurons using the native solver together, see Node::update_population()
+    bool has_population_update() const { return P_.native_integrator; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     // END Boilerplate function declarations ----------------------------
 
     // Friends --------------------------------------------------------
@@ -180,6 +189,7 @@ namespace nest
       double_t tau_synE;    //!< Synaptic Time Constant Excitatory Synapse in ms
       double_t tau_synI;    //!< Synaptic Time Constant for Inhibitory Synapse in ms
       double_t I_e;         //!< Constant Current in pA
+      bool     native_integrator; //!< Integrate with BatchODESolver instead of GSL
   
       Parameters_();        //!< Set default parameter values
 
@@ -261,6 +271,9 @@ namespace nest
       double_t step_;           //!< step size in ms
       double   IntegrationStep_;//!< current integration time step, updated by GSL
 
+      //! Native solver, used if P_.native_integrator is set
+      BatchODESolver<State_::STATE_VEC_SIZE> solver_;
+
       /** 
        * Input current injected by CurrentEvent.
        * This variable is used to transport the current applied into the
@@ -293,6 +306,24 @@ namespace nest
       //! refractory time in steps
       int_t    RefractoryCounts;
     };
+
+    /**
+     * Right-hand side of the ODE for the native solver, for any number
+     * of neurons. The members point to one value per neuron.
+     */
+    struct Dynamics_ {
+      const double_t* g_L;
+      const double_t* C_m;
+      const double_t* E_ex;
+      const double_t* E_in;
+      const double_t* E_L;
+      const double_t* tau_synE;
+      const double_t* tau_synI;
+      const double_t* I_e;
+      const double_t* I_stim;
+
+      void operator()(const double_t*, double_t*, size_t) const;
+    };
     
     // Access functions for UniversalDataLogger -------------------------------
     
@@ -295,9 +295,9 @@ void nest::iaf_cond_exp_sfa_rr::init_state_(const Node& proto)
 
 void nest::iaf_cond_exp_sfa_rr::init_buffers_()
 {
-  B_.spike_exc_.clear();       // includes resize
-  B_.spike_inh_.clear();       // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.spike_exc_.clear(get_buffer_arena_());       // includes resize
+  B_.spike_inh_.clear(get_buffer_arena_());       // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
   Archiving_Node::clear_history();
 
   B_.logger_.reset();
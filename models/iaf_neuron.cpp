@@ -182,8 +182,8 @@ void nest::iaf_neuron::init_state_(const Node& proto)
 
 void nest::iaf_neuron::init_buffers_()
 {
-  B_.spikes_.clear();    // includes resize
-  B_.currents_.clear();  // include resize
+  B_.spikes_.clear(get_buffer_arena_());    // includes resize
+  B_.currents_.clear(get_buffer_arena_());  // include resize
   B_.logger_.reset(); // includes resize
   Archiving_Node::clear_history();
 }
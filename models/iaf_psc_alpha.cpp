@@ -28,11 +28,14 @@
 #include "doubledatum.h"
 #include "dictutils.h"
 #include "numerics.h"
+#include "population_buffer.h"
 #include "universal_data_logger_impl.h"
 
 #include <limits>
 
 nest::RecordablesMap<nest::iaf_psc_alpha> nest::iaf_psc_alpha::recordablesMap_;
+nest::PropagatorCache<nest::iaf_psc_alpha::Propagators_, 5>
+  nest::iaf_psc_alpha::propagator_cache_(&nest::iaf_psc_alpha::compute_propagators_);
 
 namespace nest
 {
@@ -189,6 +192,11 @@ namespace nest
       B_(n.B_, *this)
   {}
 
+  iaf_psc_alpha::~iaf_psc_alpha()
+  {
+    propagator_cache_.release(V_.prop_);
+  }
+
   /* ----------------------------------------------------------------
    * Node initialization functions
    * ---------------------------------------------------------------- */
@@ -201,44 +209,62 @@ namespace nest
 
   void iaf_psc_alpha::init_buffers_()
   {
-    B_.ex_spikes_.clear();       // includes resize
-    B_.in_spikes_.clear();       // includes resize
-    B_.currents_.clear();        // includes resize
+    B_.spikes_.clear(get_buffer_arena_()); // includes resize
+    B_.currents_.clear(get_buffer_arena_());        // includes resize
 
     B_.logger_.reset();
 
     Archiving_Node::clear_history();
   }
 
-  void iaf_psc_alpha::calibrate()
+  void iaf_psc_alpha::compute_propagators_(const PropagatorCache<Propagators_, 5>::Key& key,
+                                           Propagators_& prop)
   {
-    B_.logger_.init();  // ensures initialization in case mm connected after Simulate
-
-    const double h = Time::get_resolution().get_ms();
+    // the key is set up in calibrate()
+    const double h = key[0];
+    const double_t Tau = key[1];
+    const double_t C = key[2];
+    const double_t tau_ex = key[3];
+    const double_t tau_in = key[4];
 
     // these P are independent
-    V_.P11_ex_ = V_.P22_ex_ = std::exp(-h/P_.tau_ex_);
-    V_.P11_in_ = V_.P22_in_ = std::exp(-h/P_.tau_in_);
+    prop.P11_ex_ = prop.P22_ex_ = std::exp(-h/tau_ex);
+    prop.P11_in_ = prop.P22_in_ = std::exp(-h/tau_in);
 
-    V_.P33_ = std::exp(-h/P_.Tau_);
+    prop.P33_ = std::exp(-h/Tau);
 
-    V_.expm1_tau_m_ = numerics::expm1(-h/P_.Tau_);
+    prop.expm1_tau_m_ = numerics::expm1(-h/Tau);
 
     // these depend on the above. Please do not change the order.
-    V_.P30_ = -P_.Tau_/P_.C_*numerics::expm1(-h/P_.Tau_);
+    prop.P30_ = -Tau/C*numerics::expm1(-h/Tau);
 
-    V_.P21_ex_ = h * V_.P11_ex_;
-    V_.P31_ex_ = 1/P_.C_ * ((V_.P11_ex_-V_.P33_)/(-1/P_.tau_ex_- -1/P_.Tau_)- h*V_.P11_ex_)
-      /(-1/P_.Tau_ - -1/P_.tau_ex_);
-    V_.P32_ex_ = 1/P_.C_*(V_.P33_-V_.P11_ex_)/(-1/P_.Tau_ - -1/P_.tau_ex_);
+    prop.P21_ex_ = h * prop.P11_ex_;
+    prop.P31_ex_ = 1/C * ((prop.P11_ex_-prop.P33_)/(-1/tau_ex- -1/Tau)- h*prop.P11_ex_)
+      /(-1/Tau - -1/tau_ex);
+    prop.P32_ex_ = 1/C*(prop.P33_-prop.P11_ex_)/(-1/Tau - -1/tau_ex);
+
+    prop.P21_in_ = h * prop.P11_in_;
+    prop.P31_in_ = 1/C * ((prop.P11_in_-prop.P33_)/(-1/tau_in- -1/Tau)- h*prop.P11_in_)
+      /(-1/Tau - -1/tau_in);
+    prop.P32_in_ = 1/C*(prop.P33_-prop.P11_in_)/(-1/Tau - -1/tau_in);
+
+    prop.EPSCInitialValue_=1.0 * numerics::e/tau_ex;
+    prop.IPSCInitialValue_=1.0 * numerics::e/tau_in;
+  }
+
+  void iaf_psc_alpha::calibrate()
+  {
+    B_.logger_.init();  // ensures initialization in case mm connected after Simulate
 
-    V_.P21_in_ = h * V_.P11_in_;
-    V_.P31_in_ = 1/P_.C_ * ((V_.P11_in_-V_.P33_)/(-1/P_.tau_in_- -1/P_.Tau_)- h*V_.P11_in_)
-      /(-1/P_.Tau_ - -1/P_.tau_in_);
-    V_.P32_in_ = 1/P_.C_*(V_.P33_-V_.P11_in_)/(-1/P_.Tau_ - -1/P_.tau_in_);
+    // neurons with the same resolution and parameters share the propagators
+    PropagatorCache<Propagators_, 5>::Key key;
+    key[0] = Time::get_resolution().get_ms();
+    key[1] = P_.Tau_;
+    key[2] = P_.C_;
+    key[3] = P_.tau_ex_;
+    key[4] = P_.tau_in_;
 
-    V_.EPSCInitialValue_=1.0 * numerics::e/P_.tau_ex_;
-    V_.IPSCInitialValue_=1.0 * numerics::e/P_.tau_in_;
+    V_.prop_ = propagator_cache_.update(V_.prop_, key);
 
     // TauR specifies the length of the absolute refractory period as
     // a double_t in ms. The grid based iaf_psc_alpha can only handle refractory
@@ -273,15 +299,17 @@ namespace nest
     assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
     assert(from < to);
 
+    const Propagators_& prop = *V_.prop_;
+
     for ( long_t lag = from ; lag < to ; ++lag )
     {
       if ( S_.r_ == 0 )
       {
         // neuron not refractory
-        S_.y3_ = V_.P30_*(S_.y0_ + P_.I_e_)
-                 + V_.P31_ex_ * S_.y1_ex_ + V_.P32_ex_ * S_.y2_ex_
-                 + V_.P31_in_ * S_.y1_in_ + V_.P32_in_ * S_.y2_in_
-                 + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
+        S_.y3_ = prop.P30_*(S_.y0_ + P_.I_e_)
+                 + prop.P31_ex_ * S_.y1_ex_ + prop.P32_ex_ * S_.y2_ex_
+                 + prop.P31_in_ * S_.y1_in_ + prop.P32_in_ * S_.y2_in_
+                 + prop.expm1_tau_m_ * S_.y3_ + S_.y3_;
 
         // lower bound of membrane potential
         S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_);
@@ -289,23 +317,27 @@ namespace nest
       else // neuron is absolute refractory
         --S_.r_;
 
+      // read excitatory and inhibitory input of this step together
+      double_t spikes[Buffers_::NUM_SPIKE_CHANNELS];
+      B_.spikes_.get_values(lag, spikes);
+
       // alpha shape EPSCs
-      S_.y2_ex_  = V_.P21_ex_ * S_.y1_ex_ + V_.P22_ex_ * S_.y2_ex_;
-      S_.y1_ex_ *= V_.P11_ex_;
+      S_.y2_ex_  = prop.P21_ex_ * S_.y1_ex_ + prop.P22_ex_ * S_.y2_ex_;
+      S_.y1_ex_ *= prop.P11_ex_;
 
       // Apply spikes delivered in this step; spikes arriving at T+1 have
       // an immediate effect on the state of the neuron
-      V_.weighted_spikes_ex_ = B_.ex_spikes_.get_value(lag);
-      S_.y1_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
+      V_.weighted_spikes_ex_ = spikes[Buffers_::SPIKES_EX];
+      S_.y1_ex_ += prop.EPSCInitialValue_ * V_.weighted_spikes_ex_;
 
       // alpha shape EPSCs
-      S_.y2_in_  = V_.P21_in_ * S_.y1_in_ + V_.P22_in_ * S_.y2_in_;
-      S_.y1_in_ *= V_.P11_in_;
+      S_.y2_in_  = prop.P21_in_ * S_.y1_in_ + prop.P22_in_ * S_.y2_in_;
+      S_.y1_in_ *= prop.P11_in_;
 
       // Apply spikes delivered in this step; spikes arriving at T+1 have
       // an immediate effect on the state of the neuron
-      V_.weighted_spikes_in_ = B_.in_spikes_.get_value(lag);
-      S_.y1_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
+      V_.weighted_spikes_in_ = spikes[Buffers_::SPIKES_IN];
+      S_.y1_in_ += prop.IPSCInitialValue_ * V_.weighted_spikes_in_;
 
       // threshold crossing
       if ( S_.y3_ >= P_.Theta_)
@@ -329,16 +361,185 @@ namespace nest
     }
   }
 
+  // work space of update_population(), see PopulationBuffer
+  static PopulationBuffer<iaf_psc_alpha*> population_nodes_;
+  static PopulationBuffer<double_t> population_double_;
+  static PopulationBuffer<int_t> population_int_;
+  static PopulationBuffer<char> population_char_;
+#ifdef _OPENMP
+#pragma omp threadprivate(population_nodes_, population_double_, population_int_, population_char_)
+#endif
+
+  void iaf_psc_alpha::update_population(Node* const* nodes, size_t n,
+                                        Time const & origin, const long_t from, const long_t to)
+  {
+    assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+    assert(from < to);
+
+    // gather state and propagators of all neurons into arrays, so that the
+    // loop over neurons in each step below can be vectorized; the arrays
+    // are kept per thread between calls
+    iaf_psc_alpha** const neurons = population_nodes_.get(1, n);
+    double_t* const y0 = population_double_.get(26, n);
+    double_t* const y1_ex = y0 + n;
+    double_t* const y2_ex = y0 + 2*n;
+    double_t* const y1_in = y0 + 3*n;
+    double_t* const y2_in = y0 + 4*n;
+    double_t* const y3 = y0 + 5*n;
+    double_t* const P30 = y0 + 6*n;
+    double_t* const P31_ex = y0 + 7*n;
+    double_t* const P32_ex = y0 + 8*n;
+    double_t* const P31_in = y0 + 9*n;
+    double_t* const P32_in = y0 + 10*n;
+    double_t* const expm1_tau_m = y0 + 11*n;
+    double_t* const P11_ex = y0 + 12*n;
+    double_t* const P21_ex = y0 + 13*n;
+    double_t* const P22_ex = y0 + 14*n;
+    double_t* const P11_in = y0 + 15*n;
+    double_t* const P21_in = y0 + 16*n;
+    double_t* const P22_in = y0 + 17*n;
+    double_t* const EPSCInitialValue = y0 + 18*n;
+    double_t* const IPSCInitialValue = y0 + 19*n;
+    double_t* const I_e = y0 + 20*n;
+    double_t* const LowerBound = y0 + 21*n;
+    double_t* const Theta = y0 + 22*n;
+    double_t* const V_reset = y0 + 23*n;
+    double_t* const spikes_ex = y0 + 24*n;
+    double_t* const spikes_in = y0 + 25*n;
+    int_t* const r = population_int_.get(2, n);
+    int_t* const RefractoryCounts = r + n;
+    char* const spiked = population_char_.get(1, n);
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      iaf_psc_alpha& nrn = *static_cast<iaf_psc_alpha*>(nodes[i]);
+      neurons[i] = &nrn;
+      y0[i] = nrn.S_.y0_;
+      y1_ex[i] = nrn.S_.y1_ex_;
+      y2_ex[i] = nrn.S_.y2_ex_;
+      y1_in[i] = nrn.S_.y1_in_;
+      y2_in[i] = nrn.S_.y2_in_;
+      y3[i] = nrn.S_.y3_;
+      r[i] = nrn.S_.r_;
+      P30[i] = nrn.V_.prop_->P30_;
+      P31_ex[i] = nrn.V_.prop_->P31_ex_;
+      P32_ex[i] = nrn.V_.prop_->P32_ex_;
+      P31_in[i] = nrn.V_.prop_->P31_in_;
+      P32_in[i] = nrn.V_.prop_->P32_in_;
+      expm1_tau_m[i] = nrn.V_.prop_->expm1_tau_m_;
+      P11_ex[i] = nrn.V_.prop_->P11_ex_;
+      P21_ex[i] = nrn.V_.prop_->P21_ex_;
+      P22_ex[i] = nrn.V_.prop_->P22_ex_;
+      P11_in[i] = nrn.V_.prop_->P11_in_;
+      P21_in[i] = nrn.V_.prop_->P21_in_;
+      P22_in[i] = nrn.V_.prop_->P22_in_;
+      EPSCInitialValue[i] = nrn.V_.prop_->EPSCInitialValue_;
+      IPSCInitialValue[i] = nrn.V_.prop_->IPSCInitialValue_;
+      RefractoryCounts[i] = nrn.V_.RefractoryCounts_;
+      I_e[i] = nrn.P_.I_e_;
+      LowerBound[i] = nrn.P_.LowerBound_;
+      Theta[i] = nrn.P_.Theta_;
+      V_reset[i] = nrn.P_.V_reset_;
+    }
+
+    for ( long_t lag = from ; lag < to ; ++lag )
+    {
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        double_t spikes[Buffers_::NUM_SPIKE_CHANNELS];
+        neurons[i]->B_.spikes_.get_values(lag, spikes);
+        spikes_ex[i] = spikes[Buffers_::SPIKES_EX];
+        spikes_in[i] = spikes[Buffers_::SPIKES_IN];
+      }
+
+      // same operations as in update(), with selects instead of branches
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        double_t y3_new = P30[i]*(y0[i] + I_e[i])
+                          + P31_ex[i] * y1_ex[i] + P32_ex[i] * y2_ex[i]
+                          + P31_in[i] * y1_in[i] + P32_in[i] * y2_in[i]
+                          + expm1_tau_m[i] * y3[i] + y3[i];
+        y3_new = ( y3_new < LowerBound[i] ? LowerBound[i] : y3_new );
+        const bool active = r[i] == 0;
+        y3[i] = active ? y3_new : y3[i];
+        r[i] = active ? r[i] : r[i] - 1;
+
+        y2_ex[i]  = P21_ex[i] * y1_ex[i] + P22_ex[i] * y2_ex[i];
+        y1_ex[i] *= P11_ex[i];
+        y1_ex[i] += EPSCInitialValue[i] * spikes_ex[i];
+
+        y2_in[i]  = P21_in[i] * y1_in[i] + P22_in[i] * y2_in[i];
+        y1_in[i] *= P11_in[i];
+        y1_in[i] += IPSCInitialValue[i] * spikes_in[i];
+
+        spiked[i] = y3[i] >= Theta[i];
+        r[i] = spiked[i] ? RefractoryCounts[i] : r[i];
+        y3[i] = spiked[i] ? V_reset[i] : y3[i];
+      }
+
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        iaf_psc_alpha& nrn = *neurons[i];
+
+        if ( spiked[i] )
+        {
+          nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+          SpikeEvent se;
+          network()->send(nrn, se, lag);
+        }
+
+        y0[i] = nrn.B_.currents_.get_value(lag);
+
+        // the logger reads the state from the neuron
+        if ( not nrn.B_.logger_.empty() )
+        {
+          nrn.S_.y0_ = y0[i];
+          nrn.S_.y1_ex_ = y1_ex[i];
+          nrn.S_.y2_ex_ = y2_ex[i];
+          nrn.S_.y1_in_ = y1_in[i];
+          nrn.S_.y2_in_ = y2_in[i];
+          nrn.S_.y3_ = y3[i];
+          nrn.S_.r_ = r[i];
+          nrn.V_.weighted_spikes_ex_ = spikes_ex[i];
+          nrn.V_.weighted_spikes_in_ = spikes_in[i];
+          nrn.B_.logger_.record_data(origin.get_steps() + lag);
+        }
+      }
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      iaf_psc_alpha& nrn = *neurons[i];
+      nrn.S_.y0_ = y0[i];
+      nrn.S_.y1_ex_ = y1_ex[i];
+      nrn.S_.y2_ex_ = y2_ex[i];
+      nrn.S_.y1_in_ = y1_in[i];
+      nrn.S_.y2_in_ = y2_in[i];
+      nrn.S_.y3_ = y3[i];
+      nrn.S_.r_ = r[i];
+      nrn.V_.weighted_spikes_ex_ = spikes_ex[i];
+      nrn.V_.weighted_spikes_in_ = spikes_in[i];
+    }
+  }
+
   void iaf_psc_alpha::handle(SpikeEvent& e)
   {
     assert(e.get_delay() > 0);
 
     const double_t s = e.get_weight() * e.get_multiplicity();
 
-    if(e.get_weight() > 0.0)
-      B_.ex_spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), s);
-    else
-      B_.in_spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), s);
+    B_.spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
+                         e.get_weight() > 0.0 ? Buffers_::SPIKES_EX : Buffers_::SPIKES_IN, s);
+  }
+
+  void iaf_psc_alpha::handle_batch(SpikeEvent& e, const long_t* lags, const long* counts, size_t n)
+  {
+    assert(e.get_delay() > 0);
+
+    // a spike at lag 0 is delivered delay steps after the slice origin
+    B_.spikes_.add_values(e.get_delay(),
+                          e.get_weight() > 0.0 ? Buffers_::SPIKES_EX : Buffers_::SPIKES_IN,
+                          lags, counts, e.get_weight(), n);
   }
 
   void iaf_psc_alpha::handle(CurrentEvent& e)
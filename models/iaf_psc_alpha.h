@@ -30,6 +30,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "propagator_cache.h"
 
 /* BeginDocumentation
 Name: iaf_psc_alpha - Leaky integrate-and-fire neuron model.
@@ -95,6 +96,9 @@ Parameters:
   tau_syn_in double - Rise time of the inhibitory synaptic alpha function in ms.
   I_e        double - Constant external input current in pA.
   V_min      double - Absolute lower value for the membrane potential.
+  propagator_sets long - Number of different propagator sets in use by all
+                   neurons of the model, which share propagators if their
+                   parameters are equal (read only).
  
 Note:
   tau_m != tau_syn_{ex,in} is required by the current implementation to avoid a
@@ -134,6 +138,7 @@ namespace nest
     
     iaf_psc_alpha();
     iaf_psc_alpha(const iaf_psc_alpha&);
+    ~iaf_psc_alpha();
 
     /**
      * Import sets of overloaded virtual functions.
@@ -146,7 +151,9 @@ namespace nest
     
     void handle(SpikeEvent &);
     void handle(CurrentEvent &);
-    void handle(DataLoggingRequest &); 
+    void handle(DataLoggingRequest &);
+
+    void handle_batch(SpikeEvent &, const long_t*, const long*, size_t);
     
     port handles_test_event(SpikeEvent&, rport);
     port handles_test_event(CurrentEvent&, rport);
@@ -163,6 +170,10 @@ namespace nest
 
     void update(Time const &, const long_t, const long_t);
 
+    //! Update runs of neurons of this model together, see Node::update_population()
+    bool has_population_update() const { return true; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     // The next two classes need to be friends to access the State_ class/member
     friend class RecordablesMap<iaf_psc_alpha>;
     friend class UniversalDataLogger<iaf_psc_alpha>;
@@ -247,9 +258,11 @@ namespace nest
       Buffers_(iaf_psc_alpha&);
       Buffers_(const Buffers_&, iaf_psc_alpha&);
 
+      //! channels of spikes_
+      enum { SPIKES_EX = 0, SPIKES_IN, NUM_SPIKE_CHANNELS };
+
       /** buffers and summs up incoming spikes/currents */
-      RingBuffer ex_spikes_;
-      RingBuffer in_spikes_;
+      MultiChannelInputBuffer<NUM_SPIKE_CHANNELS> spikes_;  //!< excitatory and inhibitory, interleaved
       RingBuffer currents_;
 
       //! Logger for all analog data
@@ -259,7 +272,11 @@ namespace nest
     
     // ---------------------------------------------------------------- 
 
-    struct Variables_ {
+    /**
+     * Propagators of the model, shared by all neurons with the same
+     * resolution, Tau_, C_, tau_ex_ and tau_in_.
+     */
+    struct Propagators_ {
 
       /** Amplitude of the synaptic current.
 	  This value is chosen such that a post-synaptic potential with
@@ -267,7 +284,6 @@ namespace nest
        */
       double_t EPSCInitialValue_;
       double_t IPSCInitialValue_;
-      int_t    RefractoryCounts_;
     
       double_t P11_ex_;
       double_t P21_ex_;
@@ -282,6 +298,18 @@ namespace nest
       double_t P30_;
       double_t P33_;
       double_t expm1_tau_m_;
+    };
+
+    static void compute_propagators_(const PropagatorCache<Propagators_, 5>::Key&, Propagators_&);
+
+    // ---------------------------------------------------------------- 
+
+    struct Variables_ {
+
+      Variables_() : prop_(0) {}
+
+      const Propagators_* prop_;  //!< from propagator_cache_, set by calibrate()
+      int_t    RefractoryCounts_;
 
       double_t weighted_spikes_ex_;
       double_t weighted_spikes_in_;
@@ -316,6 +344,9 @@ namespace nest
     
     //! Mapping of recordables names to access functions
     static RecordablesMap<iaf_psc_alpha> recordablesMap_;
+
+    //! Propagators of all neurons of this model
+    static PropagatorCache<Propagators_, 5> propagator_cache_;
   };
 
   inline
@@ -359,6 +390,7 @@ namespace nest
     Archiving_Node::get_status(d);
   
     (*d)[names::recordables] = recordablesMap_.get_list();
+    (*d)[names::propagator_sets] = static_cast<long>(propagator_cache_.size());
   }
   
   inline
@@ -214,7 +214,7 @@ void iaf_psc_alpha_multisynapse::init_state_(const Node& proto)
 void iaf_psc_alpha_multisynapse::init_buffers_()
 {
   B_.spikes_.clear();          // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
 
   B_.logger_.reset();
 
@@ -258,7 +258,7 @@ void iaf_psc_alpha_multisynapse::calibrate()
     V_.P32_syn_[i] = 1/P_.C_*(V_.P33_-V_.P11_syn_[i])/(-1/P_.Tau_ - -1/P_.tau_syn_[i]);
 
     V_.PSCInitialValues_[i] = 1.0 * numerics::e/P_.tau_syn_[i];
-    B_.spikes_[i].resize();
+    B_.spikes_[i].resize(get_buffer_arena_());
   }
   
   Time r=Time::ms(P_.TauR_);
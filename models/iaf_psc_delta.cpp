@@ -30,6 +30,7 @@
 #include "doubledatum.h"
 #include "dictutils.h"
 #include "numerics.h"
+#include "population_buffer.h"
 #include "universal_data_logger_impl.h"
 
 #include <limits>
@@ -41,6 +42,8 @@ namespace nest
    * ---------------------------------------------------------------- */
 
   RecordablesMap<iaf_psc_delta> iaf_psc_delta::recordablesMap_;
+  PropagatorCache<iaf_psc_delta::Propagators_, 3>
+    iaf_psc_delta::propagator_cache_(&iaf_psc_delta::compute_propagators_);
 
   // Override the create() method with one call to RecordablesMap::insert_() 
   // for each quantity to be recorded.
@@ -177,6 +180,11 @@ nest::iaf_psc_delta::iaf_psc_delta(const iaf_psc_delta& n)
     B_(n.B_, *this)
 {}
 
+nest::iaf_psc_delta::~iaf_psc_delta()
+{
+  propagator_cache_.release(V_.prop_);
+}
+
 /* ---------------------------------------------------------------- 
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -189,21 +197,35 @@ void nest::iaf_psc_delta::init_state_(const Node& proto)
 
 void nest::iaf_psc_delta::init_buffers_()
 {
-  B_.spikes_.clear();       // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.spikes_.clear(get_buffer_arena_());       // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
   B_.logger_.reset(); // includes resize
   Archiving_Node::clear_history();
 }
 
+void nest::iaf_psc_delta::compute_propagators_(const PropagatorCache<Propagators_, 3>::Key& key,
+                                               Propagators_& prop)
+{
+  // the key is set up in calibrate()
+  const double h = key[0];
+  const double_t tau_m = key[1];
+  const double_t c_m = key[2];
+
+  prop.P33_ = std::exp(-h/tau_m);
+  prop.P30_ = 1/c_m*(1-prop.P33_)*tau_m;
+}
+
 void nest::iaf_psc_delta::calibrate()
 {
   B_.logger_.init();
 
-  const double h = Time::get_resolution().get_ms(); 
+  // neurons with the same resolution and parameters share the propagators
+  PropagatorCache<Propagators_, 3>::Key key;
+  key[0] = Time::get_resolution().get_ms();
+  key[1] = P_.tau_m_;
+  key[2] = P_.c_m_;
 
- 
-  V_.P33_ = std::exp(-h/P_.tau_m_);
-  V_.P30_ = 1/P_.c_m_*(1-V_.P33_)*P_.tau_m_;
+  V_.prop_ = propagator_cache_.update(V_.prop_, key);
 
 
   // TauR specifies the length of the absolute refractory period as 
@@ -242,12 +264,14 @@ void nest::iaf_psc_delta::update(Time const & origin,
   assert(from < to);
 
   const double_t h = Time::get_resolution().get_ms();
+  const Propagators_& prop = *V_.prop_;
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
-      S_.y3_ = V_.P30_*(S_.y0_ + P_.I_e_) + V_.P33_*S_.y3_ + B_.spikes_.get_value(lag);
+      S_.y3_ = prop.P30_*(S_.y0_ + P_.I_e_) + prop.P33_*S_.y3_ + B_.spikes_.get_value(lag);
 
       // if we have accumulated spikes from refractory period, 
       // add and reset accumulator
@@ -294,6 +318,127 @@ void nest::iaf_psc_delta::update(Time const & origin,
   }  
 }                           
                      
+// work space of update_population(), see PopulationBuffer
+static PopulationBuffer<iaf_psc_delta*> population_nodes_;
+static PopulationBuffer<double_t> population_double_;
+static PopulationBuffer<int_t> population_int_;
+static PopulationBuffer<char> population_char_;
+#ifdef _OPENMP
+#pragma omp threadprivate(population_nodes_, population_double_, population_int_, population_char_)
+#endif
+
+void nest::iaf_psc_delta::update_population(Node* const* nodes, size_t n,
+                                            Time const & origin, 
+                                            const long_t from, const long_t to)
+{
+  assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+  assert(from < to);
+
+  const double_t h = Time::get_resolution().get_ms();
+
+  // gather state and propagators of all neurons into arrays, so that the
+  // loop over neurons in each step below can be vectorized; the arrays
+  // are kept per thread between calls
+  iaf_psc_delta** const neurons = population_nodes_.get(1, n);
+  double_t* const y0 = population_double_.get(11, n);
+  double_t* const y3 = y0 + n;
+  double_t* const refr_spikes_buffer = y0 + 2*n;
+  double_t* const P30 = y0 + 3*n;
+  double_t* const P33 = y0 + 4*n;
+  double_t* const I_e = y0 + 5*n;
+  double_t* const V_min = y0 + 6*n;
+  double_t* const V_th = y0 + 7*n;
+  double_t* const V_reset = y0 + 8*n;
+  double_t* const tau_m = y0 + 9*n;
+  double_t* const spikes = y0 + 10*n;
+  int_t* const r = population_int_.get(2, n);
+  int_t* const RefractoryCounts = r + n;
+  char* const with_refr_input = population_char_.get(2, n);
+  char* const spiked = with_refr_input + n;
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_psc_delta& nrn = *static_cast<iaf_psc_delta*>(nodes[i]);
+    neurons[i] = &nrn;
+    y0[i] = nrn.S_.y0_;
+    y3[i] = nrn.S_.y3_;
+    refr_spikes_buffer[i] = nrn.S_.refr_spikes_buffer_;
+    r[i] = nrn.S_.r_;
+    P30[i] = nrn.V_.prop_->P30_;
+    P33[i] = nrn.V_.prop_->P33_;
+    RefractoryCounts[i] = nrn.V_.RefractoryCounts_;
+    I_e[i] = nrn.P_.I_e_;
+    V_min[i] = nrn.P_.V_min_;
+    V_th[i] = nrn.P_.V_th_;
+    V_reset[i] = nrn.P_.V_reset_;
+    tau_m[i] = nrn.P_.tau_m_;
+    with_refr_input[i] = nrn.P_.with_refr_input_;
+  }
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+      spikes[i] = neurons[i]->B_.spikes_.get_value(lag);
+
+    // same operations as in update(), with selects instead of branches
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      const bool active = r[i] == 0;
+
+      double_t y3_new = P30[i]*(y0[i] + I_e[i]) + P33[i]*y3[i] + spikes[i];
+
+      // spikes accumulated during the refractory period are added once it
+      // is over, spikes arriving while refractory are accumulated
+      const bool add_refr = active && with_refr_input[i] && refr_spikes_buffer[i] != 0.0;
+      y3_new = add_refr ? y3_new + refr_spikes_buffer[i] : y3_new;
+      y3_new = ( y3_new<V_min[i] ? V_min[i] : y3_new );
+      y3[i] = active ? y3_new : y3[i];
+
+      if ( not active && with_refr_input[i] )
+        refr_spikes_buffer[i] += spikes[i] * std::exp(-r[i] * h / tau_m[i]);
+      refr_spikes_buffer[i] = add_refr ? 0.0 : refr_spikes_buffer[i];
+      r[i] = active ? r[i] : r[i] - 1;
+
+      spiked[i] = y3[i] >= V_th[i];
+      r[i] = spiked[i] ? RefractoryCounts[i] : r[i];
+      y3[i] = spiked[i] ? V_reset[i] : y3[i];
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      iaf_psc_delta& nrn = *neurons[i];
+
+      if ( spiked[i] )
+      {
+        nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+        SpikeEvent se;
+        network()->send(nrn, se, lag);
+      }
+
+      y0[i] = nrn.B_.currents_.get_value(lag);
+
+      // the logger reads the state from the neuron
+      if ( not nrn.B_.logger_.empty() )
+      {
+        nrn.S_.y0_ = y0[i];
+        nrn.S_.y3_ = y3[i];
+        nrn.S_.refr_spikes_buffer_ = refr_spikes_buffer[i];
+        nrn.S_.r_ = r[i];
+        nrn.B_.logger_.record_data(origin.get_steps()+lag);
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_psc_delta& nrn = *neurons[i];
+    nrn.S_.y0_ = y0[i];
+    nrn.S_.y3_ = y3[i];
+    nrn.S_.refr_spikes_buffer_ = refr_spikes_buffer[i];
+    nrn.S_.r_ = r[i];
+  }
+}
+
 void nest::iaf_psc_delta::handle(SpikeEvent & e)
 {
   assert(e.get_delay() > 0);
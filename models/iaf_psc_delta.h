@@ -29,6 +29,7 @@
 #include "ring_buffer.h"
 #include "connection.h"
 #include "universal_data_logger.h"
+#include "propagator_cache.h"
 
 namespace nest{
   
@@ -104,6 +105,10 @@ namespace nest{
 
      refractory_input bool - If true, do not discard input during
      refractory period. Default: false.
+
+     propagator_sets long - Number of different propagator sets in use by
+     all neurons of the model, which share propagators if their parameters
+     are equal (read only).
  
      References:
      [1] Rotter S & Diesmann M (1999) Exact digital simulation of time-invariant
@@ -132,6 +137,7 @@ namespace nest{
     
     iaf_psc_delta();
     iaf_psc_delta(const iaf_psc_delta&);
+    ~iaf_psc_delta();
 
     /**
      * Import sets of overloaded virtual functions.
@@ -161,6 +167,10 @@ namespace nest{
 
     void update(Time const &, const long_t, const long_t);
 
+    //! Update runs of neurons of this model together, see Node::update_population()
+    bool has_population_update() const { return true; }
+    void update_population(Node* const*, size_t, Time const &, const long_t, const long_t);
+
     // The next two classes need to be friends to access the State_ class/member
     friend class RecordablesMap<iaf_psc_delta>;
     friend class UniversalDataLogger<iaf_psc_delta>;
@@ -257,12 +267,27 @@ namespace nest{
     // ---------------------------------------------------------------- 
 
     /**
-     * Internal variables of the model.
+     * Propagators of the model, shared by all neurons with the same
+     * resolution, tau_m_ and c_m_.
      */
-    struct Variables_ { 
+    struct Propagators_ { 
     
       double_t P30_;
       double_t P33_;  
+    };
+
+    static void compute_propagators_(const PropagatorCache<Propagators_, 3>::Key&, Propagators_&);
+
+    // ---------------------------------------------------------------- 
+
+    /**
+     * Internal variables of the model.
+     */
+    struct Variables_ { 
+
+      Variables_() : prop_(0) {}
+
+      const Propagators_* prop_;  //!< from propagator_cache_, set by calibrate()
 
       int_t       RefractoryCounts_;
 
@@ -290,6 +315,9 @@ namespace nest{
     
     //! Mapping of recordables names to access functions
     static RecordablesMap<iaf_psc_delta> recordablesMap_;
+
+    //! Propagators of all neurons of this model
+    static PropagatorCache<Propagators_, 3> propagator_cache_;
   };
 
   
@@ -333,6 +361,7 @@ void iaf_psc_delta::get_status(DictionaryDatum &d) const
   S_.get(d, P_);
   Archiving_Node::get_status(d);
   (*d)[names::recordables] = recordablesMap_.get_list();
+  (*d)[names::propagator_sets] = static_cast<long>(propagator_cache_.size());
 }
 
 inline
@@ -28,6 +28,7 @@
 #include "doubledatum.h"
 #include "dictutils.h"
 #include "numerics.h"
+#include "population_buffer.h"
 #include "universal_data_logger_impl.h"
 
 #include <limits>
@@ -37,6 +38,8 @@
  * ---------------------------------------------------------------- */
 
 nest::RecordablesMap<nest::iaf_psc_exp> nest::iaf_psc_exp::recordablesMap_;
+nest::PropagatorCache<nest::iaf_psc_exp::Propagators_, 5>
+  nest::iaf_psc_exp::propagator_cache_(&nest::iaf_psc_exp::compute_propagators_);
 
 namespace nest
 {
@@ -180,6 +183,11 @@ nest::iaf_psc_exp::iaf_psc_exp(const iaf_psc_exp &n)
     B_(n.B_, *this)
 {}
 
+nest::iaf_psc_exp::~iaf_psc_exp()
+{
+  propagator_cache_.release(V_.prop_);
+}
+
 /* ---------------------------------------------------------------- 
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -192,20 +200,21 @@ void nest::iaf_psc_exp::init_state_(const Node &proto)
 
 void nest::iaf_psc_exp::init_buffers_()
 {
-  B_.spikes_ex_.clear();        // includes resize
-  B_.spikes_in_.clear();        // includes resize
+  B_.spikes_.clear(get_buffer_arena_()); // includes resize
   B_.currents_.clear();         // includes resize
   B_.logger_.reset();
   Archiving_Node::clear_history();
 }
 
-void nest::iaf_psc_exp::calibrate()
+void nest::iaf_psc_exp::compute_propagators_(const PropagatorCache<Propagators_, 5>::Key& key,
+                                             Propagators_& prop)
 {
-  B_.currents_.resize(2);
-
-  B_.logger_.init();  // ensures initialization in case mm connected after Simulate
-
-  const double h = Time::get_resolution().get_ms(); 
+  // the key is set up in calibrate()
+  const double h = key[0];
+  const double_t Tau = key[1];
+  const double_t C = key[2];
+  const double_t tau_ex = key[3];
+  const double_t tau_in = key[4];
 
   // numbering of state vaiables: i_0 = 0, i_syn_ = 1, V_m_ = 2
 
@@ -213,26 +222,45 @@ void nest::iaf_psc_exp::calibrate()
   // needed to exactly reproduce Tsodyks network
  
   // these P are independent
-  V_.P11ex_ = std::exp(-h/P_.tau_ex_);
+  prop.P11ex_ = std::exp(-h/tau_ex);
   //P11ex_ = 1.0-h/tau_ex_;
 
-  V_.P11in_ = std::exp(-h/P_.tau_in_);
+  prop.P11in_ = std::exp(-h/tau_in);
   //P11in_ = 1.0-h/tau_in_;
 
-  V_.P22_ = std::exp(-h/P_.Tau_);
+  prop.P22_ = std::exp(-h/Tau);
   //P22_ = 1.0-h/Tau_;
 
   // these depend on the above. Please do not change the order.
   // TODO: use expm1 here to improve accuracy for small timesteps
 
-  V_.P21ex_ = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_ex_)) * V_.P11ex_ * (1.0 - std::exp(h*(1.0/P_.tau_ex_-1.0/P_.Tau_)));
+  prop.P21ex_ = Tau/(C*(1.0-Tau/tau_ex)) * prop.P11ex_ * (1.0 - std::exp(h*(1.0/tau_ex-1.0/Tau)));
   //P21ex_ = h/C_;
 
-  V_.P21in_ = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_in_)) * V_.P11in_ * (1.0 - std::exp(h*(1.0/P_.tau_in_-1.0/P_.Tau_)));
+  prop.P21in_ = Tau/(C*(1.0-Tau/tau_in)) * prop.P11in_ * (1.0 - std::exp(h*(1.0/tau_in-1.0/Tau)));
   //P21in_ = h/C_;
 
-  V_.P20_ = P_.Tau_/P_.C_*(1.0 - V_.P22_);
+  prop.P20_ = Tau/C*(1.0 - prop.P22_);
   //P20_ = h/C_;
+}
+
+void nest::iaf_psc_exp::calibrate()
+{
+  B_.currents_.resize(2);
+  for ( size_t i = 0 ; i < B_.currents_.size() ; ++i )
+    B_.currents_[i].resize(get_buffer_arena_());
+
+  B_.logger_.init();  // ensures initialization in case mm connected after Simulate
+
+  // neurons with the same resolution and parameters share the propagators
+  PropagatorCache<Propagators_, 5>::Key key;
+  key[0] = Time::get_resolution().get_ms();
+  key[1] = P_.Tau_;
+  key[2] = P_.C_;
+  key[3] = P_.tau_ex_;
+  key[4] = P_.tau_in_;
+
+  V_.prop_ = propagator_cache_.update(V_.prop_, key);
 
   // TauR specifies the length of the absolute refractory period as 
   // a double_t in ms. The grid based iaf_psc_exp can only handle refractory
@@ -261,25 +289,29 @@ void nest::iaf_psc_exp::update(const Time &origin, const long_t from, const long
   assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
   assert(from < to);
 
+  const Propagators_& prop = *V_.prop_;
+
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long_t lag = from; lag < to; ++lag )
   {	
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
-      S_.V_m_ = S_.V_m_*V_.P22_ + S_.i_syn_ex_*V_.P21ex_ + S_.i_syn_in_*V_.P21in_ + (P_.I_e_+S_.i_0_)*V_.P20_; 
+      S_.V_m_ = S_.V_m_*prop.P22_ + S_.i_syn_ex_*prop.P21ex_ + S_.i_syn_in_*prop.P21in_ + (P_.I_e_+S_.i_0_)*prop.P20_; 
     else 
       --S_.r_ref_; // neuron is absolute refractory
 
     // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+    S_.i_syn_ex_ *= prop.P11ex_;
+    S_.i_syn_in_ *= prop.P11in_;
 
     // add evolution of presynaptic input current
-    S_.i_syn_ex_ += (1. - V_.P11ex_) * S_.i_1_;
+    S_.i_syn_ex_ += (1. - prop.P11ex_) * S_.i_1_;
 
     // the spikes arriving at T+1 have an immediate effect on the state of the neuron
     
-    V_.weighted_spikes_ex_ = B_.spikes_ex_.get_value(lag);
-    V_.weighted_spikes_in_ = B_.spikes_in_.get_value(lag);
+    double_t spikes[Buffers_::NUM_SPIKE_CHANNELS];
+    B_.spikes_.get_values(lag, spikes);
+    V_.weighted_spikes_ex_ = spikes[Buffers_::SPIKES_EX];
+    V_.weighted_spikes_in_ = spikes[Buffers_::SPIKES_IN];
     
     S_.i_syn_ex_ += V_.weighted_spikes_ex_;
     S_.i_syn_in_ += V_.weighted_spikes_in_;
@@ -305,16 +337,158 @@ void nest::iaf_psc_exp::update(const Time &origin, const long_t from, const long
   }  
 }                           
                      
+// work space of update_population(), see PopulationBuffer
+static nest::PopulationBuffer<nest::iaf_psc_exp*> population_nodes_;
+static nest::PopulationBuffer<nest::double_t> population_double_;
+static nest::PopulationBuffer<nest::int_t> population_int_;
+static nest::PopulationBuffer<char> population_char_;
+#ifdef _OPENMP
+#pragma omp threadprivate(population_nodes_, population_double_, population_int_, population_char_)
+#endif
+
+void nest::iaf_psc_exp::update_population(Node* const* nodes, size_t n,
+                                          const Time &origin, const long_t from, const long_t to)
+{
+  assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
+  assert(from < to);
+
+  // gather state and propagators of all neurons into arrays, so that the
+  // loop over neurons in each step below can be vectorized; the arrays
+  // are kept per thread between calls
+  iaf_psc_exp** const neurons = population_nodes_.get(1, n);
+  double_t* const V_m = population_double_.get(16, n);
+  double_t* const i_syn_ex = V_m + n;
+  double_t* const i_syn_in = V_m + 2*n;
+  double_t* const i_0 = V_m + 3*n;
+  double_t* const i_1 = V_m + 4*n;
+  double_t* const P22 = V_m + 5*n;
+  double_t* const P21ex = V_m + 6*n;
+  double_t* const P21in = V_m + 7*n;
+  double_t* const P20 = V_m + 8*n;
+  double_t* const P11ex = V_m + 9*n;
+  double_t* const P11in = V_m + 10*n;
+  double_t* const I_e = V_m + 11*n;
+  double_t* const Theta = V_m + 12*n;
+  double_t* const V_reset = V_m + 13*n;
+  double_t* const spikes_ex = V_m + 14*n;
+  double_t* const spikes_in = V_m + 15*n;
+  int_t* const r_ref = population_int_.get(2, n);
+  int_t* const RefractoryCounts = r_ref + n;
+  char* const spiked = population_char_.get(1, n);
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_psc_exp& nrn = *static_cast<iaf_psc_exp*>(nodes[i]);
+    neurons[i] = &nrn;
+    V_m[i] = nrn.S_.V_m_;
+    i_syn_ex[i] = nrn.S_.i_syn_ex_;
+    i_syn_in[i] = nrn.S_.i_syn_in_;
+    i_0[i] = nrn.S_.i_0_;
+    i_1[i] = nrn.S_.i_1_;
+    r_ref[i] = nrn.S_.r_ref_;
+    P22[i] = nrn.V_.prop_->P22_;
+    P21ex[i] = nrn.V_.prop_->P21ex_;
+    P21in[i] = nrn.V_.prop_->P21in_;
+    P20[i] = nrn.V_.prop_->P20_;
+    P11ex[i] = nrn.V_.prop_->P11ex_;
+    P11in[i] = nrn.V_.prop_->P11in_;
+    RefractoryCounts[i] = nrn.V_.RefractoryCounts_;
+    I_e[i] = nrn.P_.I_e_;
+    Theta[i] = nrn.P_.Theta_;
+    V_reset[i] = nrn.P_.V_reset_;
+  }
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      double_t spikes[Buffers_::NUM_SPIKE_CHANNELS];
+      neurons[i]->B_.spikes_.get_values(lag, spikes);
+      spikes_ex[i] = spikes[Buffers_::SPIKES_EX];
+      spikes_in[i] = spikes[Buffers_::SPIKES_IN];
+    }
+
+    // same operations as in update(), with selects instead of branches
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      const double_t V_new = V_m[i]*P22[i] + i_syn_ex[i]*P21ex[i] + i_syn_in[i]*P21in[i] + (I_e[i]+i_0[i])*P20[i];
+      const bool active = r_ref[i] == 0;
+      V_m[i] = active ? V_new : V_m[i];
+      r_ref[i] = active ? r_ref[i] : r_ref[i] - 1;
+
+      i_syn_ex[i] *= P11ex[i];
+      i_syn_in[i] *= P11in[i];
+      i_syn_ex[i] += (1. - P11ex[i]) * i_1[i];
+
+      i_syn_ex[i] += spikes_ex[i];
+      i_syn_in[i] += spikes_in[i];
+
+      spiked[i] = V_m[i] >= Theta[i];
+      r_ref[i] = spiked[i] ? RefractoryCounts[i] : r_ref[i];
+      V_m[i] = spiked[i] ? V_reset[i] : V_m[i];
+    }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      iaf_psc_exp& nrn = *neurons[i];
+
+      if ( spiked[i] )
+      {
+        nrn.set_spiketime(Time::step(origin.get_steps()+lag+1));
+        SpikeEvent se;
+        network()->send(nrn, se, lag);
+      }
+
+      i_0[i] = nrn.B_.currents_[0].get_value(lag);
+      i_1[i] = nrn.B_.currents_[1].get_value(lag);
+
+      // the logger reads the state from the neuron
+      if ( not nrn.B_.logger_.empty() )
+      {
+        nrn.S_.V_m_ = V_m[i];
+        nrn.S_.i_syn_ex_ = i_syn_ex[i];
+        nrn.S_.i_syn_in_ = i_syn_in[i];
+        nrn.S_.i_0_ = i_0[i];
+        nrn.S_.i_1_ = i_1[i];
+        nrn.S_.r_ref_ = r_ref[i];
+        nrn.V_.weighted_spikes_ex_ = spikes_ex[i];
+        nrn.V_.weighted_spikes_in_ = spikes_in[i];
+        nrn.B_.logger_.record_data(origin.get_steps() + lag);
+      }
+    }
+  }
+
+  for ( size_t i = 0 ; i < n ; ++i )
+  {
+    iaf_psc_exp& nrn = *neurons[i];
+    nrn.S_.V_m_ = V_m[i];
+    nrn.S_.i_syn_ex_ = i_syn_ex[i];
+    nrn.S_.i_syn_in_ = i_syn_in[i];
+    nrn.S_.i_0_ = i_0[i];
+    nrn.S_.i_1_ = i_1[i];
+    nrn.S_.r_ref_ = r_ref[i];
+    nrn.V_.weighted_spikes_ex_ = spikes_ex[i];
+    nrn.V_.weighted_spikes_in_ = spikes_in[i];
+  }
+}
+
 void nest::iaf_psc_exp::handle(SpikeEvent &e)
 {
   assert ( e.get_delay() > 0 );
 
-  if ( e.get_weight() >= 0.0 )
-    B_.spikes_ex_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), 
-			    e.get_weight() * e.get_multiplicity() );
-  else
-    B_.spikes_in_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), 
-			    e.get_weight() * e.get_multiplicity() );
+  B_.spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
+                       e.get_weight() >= 0.0 ? Buffers_::SPIKES_EX : Buffers_::SPIKES_IN,
+                       e.get_weight() * e.get_multiplicity() );
+}
+
+void nest::iaf_psc_exp::handle_batch(SpikeEvent &e, const long_t* lags, const long* counts, size_t n)
+{
+  assert ( e.get_delay() > 0 );
+
+  // a spike at lag 0 is delivered delay steps after the slice origin
+  B_.spikes_.add_values(e.get_delay(),
+                        e.get_weight() >= 0.0 ? Buffers_::SPIKES_EX : Buffers_::SPIKES_IN,
+                        lags, counts, e.get_weight(), n);
 }
 
 void nest::iaf_psc_exp::handle(CurrentEvent &e)
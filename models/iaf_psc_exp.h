@@ -30,6 +30,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "propagator_cache.h"
 
 namespace nest
 {
@@ -90,6 +91,9 @@ namespace nest
      V_reset      double - Reset membrane potential after a spike in mV.
      I_e          double - Constant input current in pA.
      t_spike      double - Point in time of last spike in ms.
+     propagator_sets long - Number of different propagator sets in use by
+                     all neurons of the model, which share propagators if
+                     their parameters are equal (read only).
  
      Note:
      tau_m != tau_syn_{ex,in} is required by the current implementation to avoid a
@@ -127,6 +131,7 @@ namespace nest
     
     iaf_psc_exp();
     iaf_psc_exp(const iaf_psc_exp&);
+    ~iaf_psc_exp();
 
     /**
      * Import sets of overloaded virtual functions.
@@ -140,6 +145,8 @@ namespace nest
     void handle(SpikeEvent &);
     void handle(CurrentEvent &);
     void handle(DataLoggingRequest &);
+
+    void handle_batch(SpikeEvent &, const long_t*, const long*, size_t);
     
     port handles_test_event(SpikeEvent&, rport);
     port handles_test_event(CurrentEvent&, rport);
@@ -156,6 +163,10 @@ namespace nest
 
     void update(const Time &, const long_t, const long_t);
 
+    //! Update runs of neurons of this model together, see Node::update_population()
+    bool has_population_update() const { return true; }
+    void update_population(Node* const*, size_t, const Time &, const long_t, const long_t);
+
     // The next two classes need to be friends to access the State_ class/member
     friend class RecordablesMap<iaf_psc_exp>;
     friend class UniversalDataLogger<iaf_psc_exp>;
@@ -244,9 +255,11 @@ namespace nest
       Buffers_(iaf_psc_exp &);
       Buffers_(const Buffers_ &, iaf_psc_exp &);
 
+      //! channels of spikes_
+      enum { SPIKES_EX = 0, SPIKES_IN, NUM_SPIKE_CHANNELS };
+
       /** buffers and sums up incoming spikes/currents */
-      RingBuffer spikes_ex_;
-      RingBuffer spikes_in_;
+      MultiChannelInputBuffer<NUM_SPIKE_CHANNELS> spikes_;  //!< excitatory and inhibitory, interleaved
       std::vector<RingBuffer> currents_;
 
       //! Logger for all analog data
@@ -256,10 +269,11 @@ namespace nest
     // ---------------------------------------------------------------- 
 
     /**
-     * Internal variables of the model.
+     * Propagators of the model, shared by all neurons with the same
+     * resolution, Tau_, C_, tau_ex_ and tau_in_.
      */
-    struct Variables_
-    { 
+    struct Propagators_
+    {
       /** Amplitude of the synaptic current.
 	  This value is chosen such that a post-synaptic potential with
 	  weight one has an amplitude of 1 mV.
@@ -274,6 +288,20 @@ namespace nest
       double_t P21ex_;
       double_t P21in_;
       double_t P22_;
+    };
+
+    static void compute_propagators_(const PropagatorCache<Propagators_, 5>::Key&, Propagators_&);
+
+    // ---------------------------------------------------------------- 
+
+    /**
+     * Internal variables of the model.
+     */
+    struct Variables_
+    { 
+      Variables_() : prop_(0) {}
+
+      const Propagators_* prop_;  //!< from propagator_cache_, set by calibrate()
       
       double_t weighted_spikes_ex_;
       double_t weighted_spikes_in_;
@@ -308,6 +336,9 @@ namespace nest
 
     //! Mapping of recordables names to access functions
     static RecordablesMap<iaf_psc_exp> recordablesMap_;
+
+    //! Propagators of all neurons of this model
+    static PropagatorCache<Propagators_, 5> propagator_cache_;
   };
 
 
@@ -355,6 +386,7 @@ port iaf_psc_exp::handles_test_event(DataLoggingRequest& dlr,
     Archiving_Node::get_status(d);
 
     (*d)[names::recordables] = recordablesMap_.get_list();
+    (*d)[names::propagator_sets] = static_cast<long>(propagator_cache_.size());
   }
 
   inline
@@ -204,7 +204,7 @@ void iaf_psc_exp_multisynapse::init_state_(const Node& proto)
 void iaf_psc_exp_multisynapse::init_buffers_()
 {
   B_.spikes_.clear();          // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
 
   B_.logger_.reset();
 
@@ -238,7 +238,7 @@ void nest::iaf_psc_exp_multisynapse::calibrate()
     V_.P11_syn_[i] = std::exp(-h/P_.tau_syn_[i]);
     V_.P21_syn_[i] = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_syn_[i])) * V_.P11_syn_[i] * (1.0 - std::exp(h*(1.0/P_.tau_syn_[i]-1.0/P_.Tau_)));
 
-    B_.spikes_[i].resize();
+    B_.spikes_[i].resize(get_buffer_arena_());
   }
 
   V_.RefractoryCounts_ = Time(Time::ms(P_.t_ref_)).get_steps();
@@ -194,9 +194,9 @@ namespace nest
 
   void nest::iaf_tum_2000::init_buffers_()
   {
-    B_.spikes_ex_.clear();       // includes resize
-    B_.spikes_in_.clear();       // includes resize
-    B_.currents_.clear();        // includes resize
+    B_.spikes_ex_.clear(get_buffer_arena_());       // includes resize
+    B_.spikes_in_.clear(get_buffer_arena_());       // includes resize
+    B_.currents_.clear(get_buffer_arena_());        // includes resize
     B_.logger_.reset(); // includes resize
     Archiving_Node::clear_history();
   }
@@ -231,11 +231,15 @@ void nest::noise_generator::update(Time const &origin, const long_t from, const
     // >= in case we woke from inactivity  
     if( now >= B_.next_step_ )
     {
-      // compute new currents
+      // compute new currents, drawing the normal numbers for all targets at once
+      if ( !B_.amps_.empty() )
+	V_.normal_dev_.fill(net_->get_rng(get_thread()), &B_.amps_[0], B_.amps_.size());
+
+      const double_t sigma = std::sqrt( P_.std_ *  P_.std_ + S_.y_1_ * P_.std_mod_ *  P_.std_mod_ );
       for ( AmpVec_::iterator it = B_.amps_.begin() ;
             it != B_.amps_.end() ; ++it )
 	{
-	  *it = P_.mean_ + std::sqrt( P_.std_ *  P_.std_ + S_.y_1_ * P_.std_mod_ *  P_.std_mod_ ) * V_.normal_dev_(net_->get_rng(get_thread()));
+	  *it = P_.mean_ + sigma * *it;
 	}
 
       // use now as reference, in case we woke up from inactive period
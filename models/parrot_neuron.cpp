@@ -39,7 +39,7 @@ parrot_neuron::parrot_neuron()
 
 void parrot_neuron::init_buffers_()
 {
-  B_.n_spikes_.clear();  // includes resize
+  B_.n_spikes_.clear(get_buffer_arena_());  // includes resize
   Archiving_Node::clear_history();
 }
 
@@ -32,7 +32,15 @@
  * ---------------------------------------------------------------- */
 
 nest::poisson_generator::Parameters_::Parameters_()
-  : rate_(0.0    )  // pA
+  : rate_(0.0    ),  // pA
+    batched_(false)
+{}
+
+nest::poisson_generator::Buffers_::Buffers_()
+  : lags_(),
+    counts_(),
+    next_count_(0),
+    n_targets_(0)
 {}
 
 
@@ -43,11 +51,13 @@ nest::poisson_generator::Parameters_::Parameters_()
 void nest::poisson_generator::Parameters_::get(DictionaryDatum &d) const
 {
   def<double>(d, names::rate, rate_);
+  def<bool>(d, names::batched, batched_);
 }
 
 void nest::poisson_generator::Parameters_::set(const DictionaryDatum& d)
 {
   updateValue<double>(d, names::rate, rate_);
+  updateValue<bool>(d, names::batched, batched_);
   if ( rate_ < 0 )
     throw BadProperty("The rate cannot be negative.");
 }
@@ -60,13 +70,15 @@ void nest::poisson_generator::Parameters_::set(const DictionaryDatum& d)
 nest::poisson_generator::poisson_generator()
   : Node(),
     device_(),
-    P_()
+    P_(),
+    B_()
 {}
 
 nest::poisson_generator::poisson_generator(const poisson_generator& n)
   : Node(n),
     device_(n.device_),
-    P_(n.P_)
+    P_(n.P_),
+    B_()
 {}
 
 
@@ -84,6 +96,10 @@ void nest::poisson_generator::init_state_(const Node& proto)
 void nest::poisson_generator::init_buffers_()
 {
   device_.init_buffers();
+  B_.lags_.clear();
+  B_.counts_.clear();
+  B_.next_count_ = 0;
+  B_.n_targets_ = 0;
 }
 
 void nest::poisson_generator::calibrate()
@@ -107,6 +123,29 @@ void nest::poisson_generator::update(Time const & T, const long_t from, const lo
   if ( P_.rate_ <= 0 )
     return;
 
+  if ( P_.batched_ )
+  {
+    B_.lags_.clear();
+    for ( long_t lag = from ; lag < to ; ++lag )
+      if ( device_.is_active( T + Time::step(lag) ) )
+        B_.lags_.push_back(lag);
+
+    if ( B_.lags_.empty() )
+      return;
+
+    // draw the counts for as many targets as were reached in the
+    // last slice at once; deliver_batch_() draws for any further ones
+    B_.counts_.resize(B_.n_targets_ * B_.lags_.size());
+    if ( !B_.counts_.empty() )
+      V_.poisson_dev_.lfill(net_->get_rng(get_thread()), &B_.counts_[0], B_.counts_.size());
+    B_.next_count_ = 0;
+    B_.n_targets_ = 0;
+
+    DSSpikeEvent se;
+    network()->send(*this, se, B_.lags_[0]);
+    return;
+  }
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     if ( !device_.is_active( T + Time::step(lag) ) )
@@ -119,6 +158,12 @@ void nest::poisson_generator::update(Time const & T, const long_t from, const lo
 
 void nest::poisson_generator::event_hook(DSSpikeEvent& e)
 {
+  if ( P_.batched_ )
+  {
+    deliver_batch_(e);
+    return;
+  }
+
   librandom::RngPtr rng = net_->get_rng(get_thread());
   long_t n_spikes = V_.poisson_dev_.ldev(rng);
 
@@ -128,3 +173,22 @@ void nest::poisson_generator::event_hook(DSSpikeEvent& e)
     e.get_receiver().handle(e);
   }
 }
+
+void nest::poisson_generator::deliver_batch_(DSSpikeEvent& e)
+{
+  const size_t n_lags = B_.lags_.size();
+
+  if ( B_.next_count_ + n_lags > B_.counts_.size() )
+  {
+    // more targets than in the last slice
+    B_.counts_.resize(B_.next_count_ + n_lags);
+    V_.poisson_dev_.lfill(net_->get_rng(get_thread()), &B_.counts_[B_.next_count_], n_lags);
+  }
+
+  const long* const counts = &B_.counts_[B_.next_count_];
+  B_.next_count_ += n_lags;
+  ++B_.n_targets_;
+
+  // hand the spikes of all lags to the receiver at once
+  e.get_receiver().handle_batch(e, &B_.lags_[0], counts, n_lags);
+}
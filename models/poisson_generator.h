@@ -56,6 +56,8 @@ Parameters:
    The following parameters appear in the element's status dictionary:
 
    rate     double - mean firing rate in Hz
+   batched  bool   - if true, deliver the spikes of a whole time slice at once
+                     (default: false), see below
    origin   double - Time origin for device timer in ms
    start    double - begin of device application with resp. to origin in ms
    stop     double - end of device application with resp. to origin in ms
@@ -93,6 +95,15 @@ Remarks:
 
    http://ken.brainworks.uni-freiburg.de/cgi-bin/mailman/private/nest_developer/2011-January/002977.html
 
+   With batched true, the generator sends only one event per time slice
+   (min_delay steps). The spike counts of all targets for all steps of the
+   slice are drawn in one call, and the event hook hands each target the
+   spikes of all steps with the proper time stamps. This saves one pass
+   through the connection infrastructure per time step, but gives a
+   different random sequence than the default mode. Synapses see only one
+   event per slice, so batched mode should only be used with static
+   synapses.
+
 SeeAlso: poisson_generator_ps, Device, parrot_neuron
 */
 
@@ -130,6 +141,9 @@ SeeAlso: poisson_generator_ps, Device, parrot_neuron
     void update(Time const &, const long_t, const long_t);
     void event_hook(DSSpikeEvent&);
 
+    //! event hook for batched mode
+    void deliver_batch_(DSSpikeEvent&);
+
     // ------------------------------------------------------------
 
     /**
@@ -137,6 +151,7 @@ SeeAlso: poisson_generator_ps, Device, parrot_neuron
      */
     struct Parameters_ {
       double_t rate_;   //!< process rate in Hz
+      bool batched_;    //!< send one event per slice
 
       Parameters_();  //!< Sets default parameter values
 
@@ -152,9 +167,24 @@ SeeAlso: poisson_generator_ps, Device, parrot_neuron
 
     // ------------------------------------------------------------
 
+    /**
+     * Spike counts for batched mode.
+     */
+    struct Buffers_ {
+      std::vector<long_t> lags_;  //!< active lags in the current slice
+      std::vector<long> counts_;  //!< counts for all targets, lags_.size() per target
+      size_t next_count_;         //!< first entry of counts_ for the next target
+      size_t n_targets_;          //!< number of targets reached in the current slice
+
+      Buffers_();
+    };
+
+    // ------------------------------------------------------------
+
     StimulatingDevice<SpikeEvent> device_;
     Parameters_ P_;
     Variables_  V_;
+    Buffers_    B_;
 
   };
 
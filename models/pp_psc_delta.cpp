@@ -245,8 +245,8 @@ void nest::pp_psc_delta::init_state_(const Node& proto)
 
 void nest::pp_psc_delta::init_buffers_()
 {
-  B_.spikes_.clear();           //!< includes resize
-  B_.currents_.clear();         //!< includes resize
+  B_.spikes_.clear(get_buffer_arena_());           //!< includes resize
+  B_.currents_.clear(get_buffer_arena_());         //!< includes resize
   B_.logger_.reset();           //!< includes resize
   Archiving_Node::clear_history();
 }
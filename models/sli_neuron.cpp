@@ -94,9 +94,9 @@ void nest::sli_neuron::init_state_(const Node& proto)
 
 void nest::sli_neuron::init_buffers_()
 {
-  B_.ex_spikes_.clear();       // includes resize
-  B_.in_spikes_.clear();       // includes resize
-  B_.currents_.clear();        // includes resize
+  B_.ex_spikes_.clear(get_buffer_arena_());       // includes resize
+  B_.in_spikes_.clear(get_buffer_arena_());       // includes resize
+  B_.currents_.clear(get_buffer_arena_());        // includes resize
   B_.logger_.reset(); // includes resize
   Archiving_Node::clear_history();
 }
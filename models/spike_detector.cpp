@@ -58,7 +58,7 @@ void nest::spike_detector::init_buffers_()
 {
   device_.init_buffers();
 
-  std::vector<std::vector<Event*> > tmp(2, std::vector<Event*>());
+  std::vector<std::vector<Spike_> > tmp(2, std::vector<Spike_>());
   B_.spikes_.swap(tmp);
 }
 
@@ -79,18 +79,13 @@ void nest::spike_detector::calibrate()
 
 void nest::spike_detector::update(Time const&, const long_t, const long_t)
 {
-  for(std::vector<Event*>::iterator 
-      e = B_.spikes_[network()->read_toggle()].begin();
-      e != B_.spikes_[network()->read_toggle()].end(); ++e)
-  {
-    assert(*e != 0);
-    device_.record_event(**e);
-    delete *e;
-  }
+  std::vector<Spike_>& spikes = B_.spikes_[network()->read_toggle()];
+  for(std::vector<Spike_>::const_iterator s = spikes.begin(); s != spikes.end(); ++s)
+    device_.record_event(s->gid, Time::step(s->step), s->offset, s->weight);
   
   // do not use swap here to clear, since we want to keep the reserved()
   // memory for the next round
-  B_.spikes_[network()->read_toggle()].clear();  
+  spikes.clear();  
 } 
 
 void nest::spike_detector::get_status(DictionaryDatum &d) const
@@ -131,11 +126,8 @@ void nest::spike_detector::handle(SpikeEvent & e)
     else
       dest_buffer = network()->write_toggle();  // locally delivered events
 
-    for (int_t i = 0; i < e.get_multiplicity(); ++i)
-    {
-      // We store the complete events
-      Event *event = e.clone();
-      B_.spikes_[dest_buffer].push_back(event);
-    }
+    const Spike_ spike = { e.get_sender_gid(), e.get_stamp().get_steps(),
+                           e.get_offset(), e.get_weight() };
+    B_.spikes_[dest_buffer].insert(B_.spikes_[dest_buffer].end(), e.get_multiplicity(), spike);
   }
 }
@@ -59,6 +59,10 @@ desired to be recorded, are recorded.
 
 Spike are not necessarily written to file in chronological order.
 
+For high spike rates, setting /memory_mapped to true writes spikes to file
+as binary records, which can be read in PyNEST using
+nest.recordings.read_mapped_spikes() (see RecordingDevice).
+
 Receives: SpikeEvent
 
 SeeAlso: spike_detector, Device, RecordingDevice
@@ -144,7 +148,10 @@ namespace nest
      * This data structure buffers all incoming spikes until they are
      * passed to the RecordingDevice for storage or output during update().
      * update() always reads from spikes_[network()->read_toggle()] and
-     * deletes all events that have been read.
+     * clears it after all spikes have been recorded. Spikes are kept as
+     * compact records rather than as copies of the events, so that
+     * buffering a spike does not allocate memory once the buffers have
+     * grown to their working size.
      *
      * Events arriving from locally sending nodes, i.e., devices without
      * proxies, are stored in spikes_[network()->write_toggle()], to ensure
@@ -157,8 +164,15 @@ namespace nest
      * This does not violate order-independence, since all spikes are delivered
      * from the global queue before any node is updated.
      */
+    struct Spike_ {
+      index    gid;     //!< sender GID
+      long_t   step;    //!< time stamp in steps
+      double_t offset;  //!< offset of precise spike time
+      double_t weight;  //!< weight of the event
+    };
+
     struct Buffers_ {
-      std::vector<std::vector<Event*> > spikes_; 
+      std::vector<std::vector<Spike_> > spikes_; 
     };
     
     RecordingDevice device_;
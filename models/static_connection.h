@@ -42,6 +42,7 @@
 #define STATICCONNECTION_H
 
 #include "connection.h"
+#include "static_connector.h"
 
 namespace nest
 {
@@ -123,6 +124,8 @@ class StaticConnection : public Connection<targetidentifierT>
   void set_status(const DictionaryDatum & d, ConnectorModel& cm);
 
   void set_weight (double_t w) { weight_ = w; }
+
+  double_t get_weight() const { return weight_; }
 };
 
 template<typename targetidentifierT>
@@ -141,6 +144,21 @@ void StaticConnection<targetidentifierT>::set_status(const DictionaryDatum & d,
   updateValue<double_t>(d, names::weight, weight_);
 }
 
+/**
+ * Connectors with many static connections store targets, delays and
+ * weights in separate arrays, see StaticConnector.
+ */
+template<typename targetidentifierT>
+class Connector<K_cutoff, StaticConnection<targetidentifierT> >
+  : public StaticConnector<StaticConnection<targetidentifierT>, targetidentifierT, IndividualWeights>
+{
+public:
+  Connector(const Connector<K_cutoff-1, StaticConnection<targetidentifierT> > &C,
+            const StaticConnection<targetidentifierT> &c)
+    : StaticConnector<StaticConnection<targetidentifierT>, targetidentifierT, IndividualWeights>(C, c)
+  {}
+};
+
 } // namespace
 
 #endif /* #ifndef STATICCONNECTION_H */
@@ -46,6 +46,7 @@
 
 #include "connection.h"
 #include "common_properties_hom_w.h"
+#include "static_connector.h"
 
 namespace nest
 {
@@ -124,6 +125,21 @@ class StaticConnectionHomW : public Connection<targetidentifierT>
       def<long_t>(d, names::size_of, sizeof(*this));
     }
 
+/**
+ * Connectors with many static connections with homogeneous weight
+ * store targets and delays in separate arrays, see StaticConnector.
+ */
+template<typename targetidentifierT>
+class Connector<K_cutoff, StaticConnectionHomW<targetidentifierT> >
+  : public StaticConnector<StaticConnectionHomW<targetidentifierT>, targetidentifierT, HomogeneousWeight>
+{
+public:
+  Connector(const Connector<K_cutoff-1, StaticConnectionHomW<targetidentifierT> > &C,
+            const StaticConnectionHomW<targetidentifierT> &c)
+    : StaticConnector<StaticConnectionHomW<targetidentifierT>, targetidentifierT, HomogeneousWeight>(C, c)
+  {}
+};
+
 } // namespace
 
 #endif /* #ifndef STATICCONNECTION_HOM_W_H */
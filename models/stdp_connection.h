@@ -204,25 +204,28 @@ void STDPConnection<targetidentifierT>::send(Event& e, thread t, double_t t_last
   double_t dendritic_delay = get_delay();
 
   //get spike history in relevant range (t1, t2] from post-synaptic neuron
-  std::deque<histentry>::iterator start;
-  std::deque<histentry>::iterator finish;
+  histentry* start;
+  histentry* finish;
 
   // For a new synapse, t_lastspike contains the point in time of the last spike.
   // So we initially read the history(t_last_spike - dendritic_delay, ...,  T_spike-dendritic_delay]
   // which increases the access counter for these entries.
   // At registration, all entries' access counters of history[0, ..., t_last_spike - dendritic_delay] have been 
   // incremented by Archiving_Node::register_stdp_connection(). See bug #218 for details.
-  target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay,
-		      &start, &finish);
+  const bool cached = target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay,
+		      &start, &finish, tau_plus_);
   //facilitation due to post-synaptic spikes since last pre-synaptic spike
+  //only the decay to the first entry is computed here, the decay between
+  //entries is precomputed in the history if it is cached for tau_plus
   double_t minus_dt;
-  while (start != finish)
+  double_t decay = 1.0;
+  for (histentry* first = start; start != finish; ++start)
   {
     minus_dt = t_lastspike - (start->t_ + dendritic_delay);
-    ++start;
+    decay = start == first ? std::exp(minus_dt / tau_plus_) : decay * (cached ? start->decay_ : std::exp(-start->dt_ / tau_plus_));
     if (minus_dt == 0)
       continue;
-    weight_ = facilitate_(weight_, Kplus_ * std::exp(minus_dt / tau_plus_));
+    weight_ = facilitate_(weight_, Kplus_ * decay);
   }
 
   //depression due to new pre-synaptic spike
@@ -386,8 +386,8 @@ void STDPFACETSHWConnectionHom<targetidentifierT>::send(Event& e, thread t, doub
   double_t dendritic_delay = Time(Time::step( get_delay_steps() )).get_ms();
 
   //get spike history in relevant range (t1, t2] from post-synaptic neuron
-  std::deque<histentry>::iterator start;
-  std::deque<histentry>::iterator finish;
+  histentry* start;
+  histentry* finish;
   get_target(t)->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay,
 			       &start, &finish);
   //facilitation due to post-synaptic spikes since last pre-synaptic spike
@@ -71,6 +71,7 @@
 */
 
 #include "connection.h"
+#include "stdp_hom_connector.h"
 #include <cmath>
 
 namespace nest
@@ -197,13 +198,16 @@ namespace nest
   
  private:
 
-  double_t facilitate_(double_t w, double_t kplus, const STDPHomCommonProperties &cp)
+  // large connectors keep weight_ and Kplus_ in arrays and update them in bulk
+  friend class STDPHomConnector<STDPConnectionHom<targetidentifierT>, targetidentifierT>;
+
+  static double_t facilitate_(double_t w, double_t kplus, const STDPHomCommonProperties &cp)
   {
     double_t norm_w = (w / cp.Wmax_) + (cp.lambda_ * std::pow(1.0 - (w/cp.Wmax_), cp.mu_plus_) * kplus);
     return norm_w < 1.0 ? norm_w * cp.Wmax_ : cp.Wmax_;
   }
 
-  double_t depress_(double_t w, double_t kminus, const STDPHomCommonProperties &cp)
+  static double_t depress_(double_t w, double_t kminus, const STDPHomCommonProperties &cp)
   {
     double_t norm_w = (w / cp.Wmax_) - (cp.alpha_ * cp.lambda_ * std::pow(w/cp.Wmax_, cp.mu_minus_) * kminus);
     return norm_w > 0.0 ? norm_w * cp.Wmax_ : 0.0;
@@ -255,19 +259,22 @@ namespace nest
     double_t dendritic_delay = get_delay();
     
     //get spike history in relevant range (t1, t2] from post-synaptic neuron
-    std::deque<histentry>::iterator start;
-    std::deque<histentry>::iterator finish;    
-    target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay, 
-			&start, &finish);
+    histentry* start;
+    histentry* finish;    
+    const bool cached = target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay, 
+			&start, &finish, cp.tau_plus_);
     //facilitation due to post-synaptic spikes since last pre-synaptic spike
+    //only the decay to the first entry is computed here, the decay between
+    //entries is precomputed in the history if it is cached for tau_plus
     double_t minus_dt;
-    while (start != finish)
+    double_t decay = 1.0;
+    for (histentry* first = start; start != finish; ++start)
       {
 	minus_dt = t_lastspike - (start->t_ + dendritic_delay);
-    ++start;
+	decay = start == first ? std::exp(minus_dt / cp.tau_plus_) : decay * (cached ? start->decay_ : std::exp(-start->dt_ / cp.tau_plus_));
 	if (minus_dt == 0)
 	  continue;
-	weight_ = facilitate_(weight_, Kplus_ * std::exp(minus_dt / cp.tau_plus_), cp);
+	weight_ = facilitate_(weight_, Kplus_ * decay, cp);
       }
 
     //depression due to new pre-synaptic spike
@@ -305,6 +312,21 @@ namespace nest
     updateValue<double_t>(d, "Kplus", Kplus_);    
   }
 
+  /**
+   * Connectors with many connections update all synapses of a
+   * presynaptic spike together, see STDPHomConnector.
+   */
+  template<typename targetidentifierT>
+  class Connector<K_cutoff, STDPConnectionHom<targetidentifierT> >
+    : public STDPHomConnector<STDPConnectionHom<targetidentifierT>, targetidentifierT>
+  {
+  public:
+    Connector(const Connector<K_cutoff-1, STDPConnectionHom<targetidentifierT> > &C,
+              const STDPConnectionHom<targetidentifierT> &c)
+      : STDPHomConnector<STDPConnectionHom<targetidentifierT>, targetidentifierT>(C, c)
+    {}
+  };
+
 } // of namespace nest
 
 #endif // of #ifndef STDP_CONNECTION_HOM_H
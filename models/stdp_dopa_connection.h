@@ -402,8 +402,8 @@ namespace nest
     const vector<spikecounter>& dopa_spikes = cp.vt_->deliver_spikes();
 
     // get spike history in relevant range (t_last_update, t_spike] from post-synaptic neuron
-    std::deque<histentry>::iterator start;
-    std::deque<histentry>::iterator finish;
+    histentry* start;
+    histentry* finish;
     target->get_history(t_last_update_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish);
 
     // facilitation due to post-synaptic spikes since last update
@@ -445,8 +445,8 @@ namespace nest
     double_t dendritic_delay = get_delay();
 
     // get spike history in relevant range (t_last_update, t_trig] from postsyn. neuron
-    std::deque<histentry>::iterator start;
-    std::deque<histentry>::iterator finish;
+    histentry* start;
+    histentry* finish;
     get_target(t)->get_history(t_last_update_ - dendritic_delay, t_trig - dendritic_delay, &start, &finish);
 
     // facilitation due to postsyn. spikes since last update
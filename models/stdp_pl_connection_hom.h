@@ -52,6 +52,7 @@
 */
 
 #include "connection.h"
+#include "stdp_hom_connector.h"
 
 #include <cmath>
 
@@ -178,12 +179,15 @@ namespace nest
   
  private:
 
-  double_t facilitate_(double_t w, double_t kplus, const STDPPLHomCommonProperties &cp)
+  // large connectors keep weight_ and Kplus_ in arrays and update them in bulk
+  friend class STDPHomConnector<STDPPLConnectionHom<targetidentifierT>, targetidentifierT>;
+
+  static double_t facilitate_(double_t w, double_t kplus, const STDPPLHomCommonProperties &cp)
   {
       return w + (cp.lambda_ * std::pow(w,cp.mu_) * kplus);
   }
   
-  double_t depress_(double_t w, double_t kminus, const STDPPLHomCommonProperties &cp)
+  static double_t depress_(double_t w, double_t kminus, const STDPPLHomCommonProperties &cp)
   {
     double_t new_w = w - (cp.lambda_ * cp.alpha_ * w * kminus);
     return new_w > 0.0 ? new_w : 0.0;
@@ -220,20 +224,23 @@ namespace nest
     double_t dendritic_delay = get_delay();
 
     //get spike history in relevant range (t1, t2] from post-synaptic neuron
-    std::deque<histentry>::iterator start;
-    std::deque<histentry>::iterator finish;    
-    target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay, 
-			&start, &finish);
+    histentry* start;
+    histentry* finish;    
+    const bool cached = target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay, 
+			&start, &finish, cp.tau_plus_);
 
     //facilitation due to post-synaptic spikes since last pre-synaptic spike
+    //only the decay to the first entry is computed here, the decay between
+    //entries is precomputed in the history if it is cached for tau_plus
     double_t minus_dt;
-    while (start != finish)
+    double_t decay = 1.0;
+    for (histentry* first = start; start != finish; ++start)
       {
 	minus_dt = t_lastspike - (start->t_ + dendritic_delay);
-	start++;
+	decay = start == first ? std::exp(minus_dt / cp.tau_plus_) : decay * (cached ? start->decay_ : std::exp(-start->dt_ / cp.tau_plus_));
 	if (minus_dt == 0)
 	  continue;
-	weight_ = facilitate_(weight_, Kplus_ * std::exp(minus_dt / cp.tau_plus_), cp);
+	weight_ = facilitate_(weight_, Kplus_ * decay, cp);
       }
 
     //depression due to new pre-synaptic spike
@@ -285,6 +292,21 @@ namespace nest
     updateValue<double_t>(d, "Kplus", Kplus_);    
   }
 
+  /**
+   * Connectors with many connections update all synapses of a
+   * presynaptic spike together, see STDPHomConnector.
+   */
+  template<typename targetidentifierT>
+  class Connector<K_cutoff, STDPPLConnectionHom<targetidentifierT> >
+    : public STDPHomConnector<STDPPLConnectionHom<targetidentifierT>, targetidentifierT>
+  {
+  public:
+    Connector(const Connector<K_cutoff-1, STDPPLConnectionHom<targetidentifierT> > &C,
+              const STDPPLConnectionHom<targetidentifierT> &c)
+      : STDPHomConnector<STDPPLConnectionHom<targetidentifierT>, targetidentifierT>(C, c)
+    {}
+  };
+
 } // of namespace nest
 
 #endif // of #ifndef STDP_PL_CONNECTION_HOM_H
@@ -74,7 +74,7 @@ void nest::volume_transmitter::init_state_(const Node &)
 
 void nest::volume_transmitter::init_buffers_()
 {
-  B_.neuromodulatory_spikes_.clear();
+  B_.neuromodulatory_spikes_.clear(get_buffer_arena_());
   B_.spikecounter_.clear();
   B_.spikecounter_.push_back(spikecounter(0.0, 0.0));  // insert pseudo last dopa spike at t = 0.0
   Archiving_Node::clear_history();
@@ -30,6 +30,19 @@
 #include "archiving_node.h"
 #include "dictutils.h"
 
+#include <algorithm>
+
+namespace {
+
+  // compares history entries by spike time, for binary search
+  struct histentry_time_less
+  {
+    bool operator()(const nest::histentry& h, nest::double_t t) const { return h.t_ < t; }
+    bool operator()(nest::double_t t, const nest::histentry& h) const { return t < h.t_; }
+  };
+
+}
+
 namespace nest {
 
   //member functions for Archiving_Node   
@@ -40,7 +53,9 @@ namespace nest {
     triplet_Kminus_(0.0),
     tau_minus_(20.0),
     tau_minus_triplet_(110.0),
-    last_spike_(-1.0)
+    last_spike_(-1.0),
+    decay_tau_(0.0),
+    history_begin_(0)
   {}
 
   nest::Archiving_Node::Archiving_Node(const Archiving_Node& n)
@@ -50,18 +65,20 @@ namespace nest {
      triplet_Kminus_(n.triplet_Kminus_),
      tau_minus_(n.tau_minus_),
      tau_minus_triplet_(n.tau_minus_triplet_),
-     last_spike_(n.last_spike_)
+     last_spike_(n.last_spike_),
+     decay_tau_(0.0),
+     history_begin_(0)
   {}
 
   void Archiving_Node::register_stdp_connection(double_t t_first_read)
   {
-    // Mark all entries in the deque, which we will not read in future as read by this input
+    // Mark all entries in the history, which we will not read in future as read by this input
     // input, so that we savely increment the incoming number of
     // connections afterwards without leaving spikes in the history.
     // For details see bug #218. MH 08-04-22
 
-    for ( std::deque<histentry>::iterator runner = history_.begin();
-	  runner != history_.end() && runner->t_ <= t_first_read;
+    for ( histentry* runner = history_start_();
+	  runner != history_end_() && runner->t_ <= t_first_read;
 	  ++runner)
       (runner->access_counter_)++;
 
@@ -70,13 +87,13 @@ namespace nest {
  
   void Archiving_Node::unregister_stdp_connection(double_t t_last_read)
   {
-    // Mark all entries in the deque we have read as unread 
+    // Mark all entries in the history we have read as unread 
     // so that we can savely decrement the incoming number of
     // connections afterwards without loosing entries, which
     // are still needed. For details see bug #218. MH 08-04-22
 
-    for ( std::deque<histentry>::iterator runner = history_.begin();
-	  runner != history_.end() && runner->t_ <= t_last_read;
+    for ( histentry* runner = history_start_();
+	  runner != history_end_() && runner->t_ <= t_last_read;
 	  ++runner)
       (runner->access_counter_)--;
 
@@ -85,13 +102,13 @@ namespace nest {
 
   double_t nest::Archiving_Node::get_K_value(double_t t)
   {
-    if (history_.empty()) return Kminus_;
-    int i = history_.size() - 1;
-    while (i >= 0)
+    if (history_size_() == 0) return Kminus_;
+    // the entry needed is usually among the last ones, so search backwards
+    for ( histentry* runner = history_end_(); runner != history_start_(); )
       {
-	if (t > history_[i].t_)
-	  return (history_[i].Kminus_*std::exp((history_[i].t_ - t)/tau_minus_));
-	i--;
+	--runner;
+	if (t > runner->t_)
+	  return (runner->Kminus_*std::exp((runner->t_ - t)/tau_minus_));
       }
     return 0;
   }
@@ -99,21 +116,20 @@ namespace nest {
   void nest::Archiving_Node::get_K_values(double_t t, double_t& K_value, double_t& triplet_K_value)
   {
     // case when the neuron has not yet spiked
-    if (history_.empty()) {
+    if (history_size_() == 0) {
       triplet_K_value = triplet_Kminus_;
       K_value = Kminus_; 
       return;
     }
     // case 
-    int i = history_.size() - 1;
-    while (i >= 0)
+    for ( histentry* runner = history_end_(); runner != history_start_(); )
       {
-	if (t > history_[i].t_) {
-	  triplet_K_value = (history_[i].triplet_Kminus_*std::exp((history_[i].t_ - t)/tau_minus_triplet_));
-	  K_value = (history_[i].Kminus_*std::exp((history_[i].t_ - t)/tau_minus_));
+	--runner;
+	if (t > runner->t_) {
+	  triplet_K_value = (runner->triplet_Kminus_*std::exp((runner->t_ - t)/tau_minus_triplet_));
+	  K_value = (runner->Kminus_*std::exp((runner->t_ - t)/tau_minus_));
 	  return;
 	}
-	i--;
       }
 
     // we only get here if t< time of all spikes in history)
@@ -124,27 +140,41 @@ namespace nest {
   }
 
   void nest::Archiving_Node::get_history(double_t t1, double_t t2,
-				   std::deque<histentry>::iterator* start,
-				   std::deque<histentry>::iterator* finish)
+				   histentry** start,
+				   histentry** finish)
   {
-    *finish = history_.end();
-    if (history_.empty())
+    // entries are sorted by time, so find the first one after t1 by bisection
+    histentry* runner = std::upper_bound(history_start_(), history_end_(), t1,
+                                         histentry_time_less());
+    *start = runner;
+    while ((runner != history_end_()) && (runner->t_ <= t2))
       {
-	*start = *finish;
-	return;
-      }
-    else
-      {
-	std::deque<histentry>::iterator runner = history_.begin();
-	while ((runner != history_.end()) && (runner->t_ <= t1)) ++runner;
-	*start = runner;
-	while ((runner != history_.end()) && (runner->t_ <= t2))
-	  {
-	    (runner->access_counter_)++;
-	    ++runner;
-	  }
-	*finish = runner;
+	(runner->access_counter_)++;
+	++runner;
       }
+    *finish = runner;
+  }
+
+  bool nest::Archiving_Node::get_history(double_t t1, double_t t2,
+				   histentry** start,
+				   histentry** finish,
+				   double_t tau)
+  {
+    get_history(t1, t2, start, finish);
+
+    // the history holds the factors for the first time constant asked
+    // for; other time constants compute their factors themselves, so
+    // that synapses with different taus do not invalidate each other
+    if ( decay_tau_ == 0.0 )
+      decay_tau_ = tau;
+    else if ( tau != decay_tau_ )
+      return false;
+
+    for ( histentry* runner = *start; runner != *finish; ++runner )
+      if ( runner->decay_ < 0.0 )
+	runner->decay_ = std::exp(-runner->dt_ / tau);
+
+    return true;
   }
 
   void nest::Archiving_Node::set_spiketime(Time const & t_sp)
@@ -153,18 +183,28 @@ namespace nest {
       {
 	  // prune all spikes from history which are no longer needed
           // except the penultimate one. we might still need it.
-	  while (history_.size() > 1)
+	  while (history_size_() > 1)
 	  {
-	      if (history_.front().access_counter_ >= n_incoming_)
-		  history_.pop_front();
+	      if (history_[history_begin_].access_counter_ >= n_incoming_)
+		  ++history_begin_;
 	      else
 		break;		
 	  }
+
+	  // drop pruned entries in bulk, so that each entry is moved
+	  // at most once on average
+	  if ( history_begin_ > 0 && 2 * history_begin_ >= history_.size() )
+	  {
+	      history_.erase(history_.begin(), history_.begin() + history_begin_);
+	      history_begin_ = 0;
+	  }
+
 	  // update spiking history
 	  Kminus_ = Kminus_ * std::exp((last_spike_ - t_sp.get_ms())/tau_minus_) + 1.0;
 	  triplet_Kminus_ = triplet_Kminus_ * std::exp((last_spike_ - t_sp.get_ms())/tau_minus_triplet_) + 1.0;
 	  last_spike_ = t_sp.get_ms();
-	  history_.push_back( histentry( last_spike_, Kminus_, triplet_Kminus_,0) );
+	  const double_t dt = history_size_() > 0 ? last_spike_ - history_.back().t_ : 0.0;
+	  history_.push_back( histentry( last_spike_, Kminus_, triplet_Kminus_, 0, dt) );
       }
       else
       {
@@ -178,7 +218,7 @@ namespace nest {
     def<double>(d, names::tau_minus, tau_minus_);
     def<double>(d, names::tau_minus_triplet, tau_minus_triplet_);
 #ifdef DEBUG_ARCHIVER
-    def<int>(d, names::archiver_length, history_.size());
+    def<int>(d, names::archiver_length, history_size_());
 #endif
   }
 
@@ -209,6 +249,7 @@ namespace nest {
       Kminus_ = 0.0;
       triplet_Kminus_ = 0.0;
       history_.clear();
+      history_begin_ = 0;
   }
 
 } // of namespace nest
@@ -36,7 +36,7 @@
 #include "dictdatum.h"
 #include "nest_time.h"
 #include "histentry.h"
-#include <deque>
+#include <vector>
 
 #define DEBUG_ARCHIVER 1
 
@@ -82,19 +82,36 @@ namespace nest {
   void get_K_values(double_t t, double_t& Kminus, double_t& triplet_Kminus); 
 
   /**
-   * \fn double_t get_triplet_K_value(std::deque<histentry>::iterator &iter)
+   * \fn double_t get_triplet_K_value(const histentry* iter)
    * return the triplet Kminus value for the associated iterator.
    */
 
-  double_t get_triplet_K_value(const std::deque<histentry>::iterator &iter);
+  double_t get_triplet_K_value(const histentry* iter);
   
   /**
-   * \fn void get_history(long_t t1, long_t t2, std::deque<Archiver::histentry>::iterator* start, std::deque<Archiver::histentry>::iterator* finish)
-   * return the spike times (in steps) of spikes which occurred in the range (t1,t2].
+   * \fn void get_history(double_t t1, double_t t2, histentry** start, histentry** finish)
+   * return the history entries of spikes which occurred in the range (t1,t2].
+   * The entries are contiguous in memory and remain valid until the next spike
+   * of the node.
    */
   void get_history(double_t t1, double_t t2, 
-                   std::deque<histentry>::iterator* start,
-  		   std::deque<histentry>::iterator* finish);
+                   histentry** start,
+  		   histentry** finish);
+
+  /**
+   * \fn bool get_history(double_t t1, double_t t2, histentry** start, histentry** finish, double_t tau)
+   * as above, and set decay_ of the returned entries to exp(-dt_/tau).
+   * The history holds factors for a single tau, the first one asked for.
+   * They are computed once and shared by all synapses asking for this tau.
+   * For any other tau, decay_ is left alone and false is returned; the
+   * caller then computes exp(-dt_/tau) itself. Multiplying the factors
+   * gives the decay between entries up to rounding, i.e. a relative
+   * deviation from exp(-(t-t_i)/tau) of a few 1e-16 per factor.
+   */
+  bool get_history(double_t t1, double_t t2, 
+                   histentry** start,
+  		   histentry** finish,
+                   double_t tau);
 
   /**
    * Register a new incoming STDP connection.
@@ -154,8 +171,22 @@ namespace nest {
 
   double_t last_spike_;
 
-  // spiking history needed by stdp synapses
-  std::deque<histentry> history_;
+  // time constant the decay_ factors in the history are computed for,
+  // 0.0 until the first call of get_history() with a time constant
+  double_t decay_tau_;
+
+  // spiking history needed by stdp synapses, live entries are
+  // history_[history_begin_], ..., history_.back(); entries before
+  // history_begin_ have been read by all synapses and are dropped
+  // in bulk once they make up half of the vector
+  std::vector<histentry> history_;
+  size_t history_begin_;
+
+  // live part of history_, [history_start_(), history_end_())
+  histentry* history_start_();
+  histentry* history_end_();
+
+  size_t history_size_() const;
 
 };
   
@@ -165,6 +196,24 @@ double_t Archiving_Node::get_spiketime_ms() const
    return last_spike_;
 }
 
+inline
+histentry* Archiving_Node::history_start_()
+{
+  return history_.empty() ? 0 : &history_[0] + history_begin_;
+}
+
+inline
+histentry* Archiving_Node::history_end_()
+{
+  return history_.empty() ? 0 : &history_[0] + history_.size();
+}
+
+inline
+size_t Archiving_Node::history_size_() const
+{
+  return history_.size() - history_begin_;
+}
+
 } // of namespace
 
 #endif
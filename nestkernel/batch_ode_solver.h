@@ -0,0 +1,289 @@
+/*
+ *  batch_ode_solver.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BATCH_ODE_SOLVER_H
+#define BATCH_ODE_SOLVER_H
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "nest.h"
+
+namespace nest
+{
+
+  /**
+   * Embedded Runge-Kutta solver advancing many instances of the same ODE
+   * system together.
+   *
+   * The solver uses the Dormand-Prince 5(4) pair with adaptive step size
+   * control, see William H. Press et al., "Adaptive Stepsize Control for
+   * Runge-Kutta", Chapter 17.2 in Numerical Recipes (3rd edition, 2007).
+   * The instances, called lanes, are typically the neurons of one model
+   * on one thread. The state of n lanes with dim variables each is stored
+   * variable by variable, i.e., variable k of lane i is y[k*n + i].
+   *
+   * The dynamics are given by a function object with the member
+   * @code
+   * void operator()(const double_t* y, double_t* f, size_t n) const;
+   * @endcode
+   * which computes the derivatives f of all lanes for the states y, in the
+   * layout above. Written as a loop over lanes, the compiler can vectorize
+   * it, and there is no call per lane through a function pointer as for
+   * the GSL solvers.
+   *
+   * Each lane has its own integration step size and error control. The
+   * solver performs rounds of trial steps of all lanes until each lane has
+   * reached the end of the interval; lanes done already take steps of zero
+   * length in later rounds, which leave their state unchanged. The error
+   * of a lane is controlled as by gsl_odeiv_control_y_new(), i.e., the
+   * local error of each variable must not exceed eps_abs + eps_rel*|y|.
+   * Steps of size h_min are accepted irrespective of the error.
+   *
+   * With n=1, the solver can be applied to the state vector of a single
+   * neuron directly.
+   *
+   * Models that must act on the state after each integration step, e.g.,
+   * to detect spikes within the simulation step, call start() and then
+   * step() until it returns false, instead of integrate(). Lanes whose
+   * trial step was rejected, or which have reached the end already, keep
+   * their state in a round, so such actions must leave a state they have
+   * been applied to unchanged.
+   */
+  template <size_t dim>
+  class BatchODESolver
+  {
+  public:
+
+    BatchODESolver(double_t eps_abs, double_t eps_rel, double_t h_min)
+      : eps_abs_(eps_abs),
+        eps_rel_(eps_rel),
+        h_min_(h_min)
+    {}
+
+    /**
+     * Advance n lanes by tend.
+     * @param f     dynamics of the system
+     * @param y     states of the lanes, updated in place
+     * @param h     integration step sizes of the lanes, updated in place;
+     *              the step size is kept across calls, it is not limited
+     *              to tend
+     * @param tend  length of the interval to integrate over
+     * @param n     number of lanes
+     */
+    template <typename DynamicsT>
+    void integrate(const DynamicsT& f, double_t* y, double_t* h, double_t tend, size_t n);
+
+    /**
+     * Begin the integration of n lanes over a new interval.
+     */
+    void start(size_t n);
+
+    /**
+     * Perform one round of trial steps, as part of integrating n lanes
+     * over tend after start(). The parameters are as for integrate().
+     * @returns false if all lanes had reached tend before the call
+     */
+    template <typename DynamicsT>
+    bool step(const DynamicsT& f, double_t* y, double_t* h, double_t tend, size_t n);
+
+    /**
+     * Time reached by lane i in the current interval.
+     */
+    double_t get_time(size_t i) const { return t_[i]; }
+
+    /**
+     * Set the error tolerances.
+     */
+    void set_tolerances(double_t eps_abs, double_t eps_rel)
+    {
+      eps_abs_ = eps_abs;
+      eps_rel_ = eps_rel;
+    }
+
+  private:
+
+    double_t eps_abs_;  //!< absolute error tolerance
+    double_t eps_rel_;  //!< relative error tolerance
+    double_t h_min_;    //!< minimal integration step size
+
+    // work arrays, kept to avoid allocation in each call
+    std::vector<double_t> k_[7];  //!< stages
+    std::vector<double_t> ytmp_;  //!< arguments of stages
+    std::vector<double_t> ynew_;  //!< 5th order solution
+    std::vector<double_t> t_;     //!< time reached by each lane
+    std::vector<double_t> hs_;    //!< step size of the current trial step of each lane
+    std::vector<double_t> err_;   //!< error of the current trial step of each lane
+
+    void resize_(size_t n);
+
+    //! ytmp_ = y + hs*(c1*k1 + ... + cs*ks) for the first s stages
+    void stage_arg_(const double_t* y, const double_t* c, size_t s, size_t n);
+  };
+
+  template <size_t dim>
+  void BatchODESolver<dim>::resize_(size_t n)
+  {
+    if ( t_.size() == n )
+      return;
+
+    for ( size_t s = 0 ; s < 7 ; ++s )
+      k_[s].resize(dim * n);
+    ytmp_.resize(dim * n);
+    ynew_.resize(dim * n);
+    t_.resize(n);
+    hs_.resize(n);
+    err_.resize(n);
+  }
+
+  template <size_t dim>
+  void BatchODESolver<dim>::start(size_t n)
+  {
+    resize_(n);
+    std::fill(t_.begin(), t_.end(), 0.0);
+  }
+
+  template <size_t dim>
+  template <typename DynamicsT>
+  void BatchODESolver<dim>::integrate(const DynamicsT& f, double_t* y, double_t* h,
+                                      double_t tend, size_t n)
+  {
+    start(n);
+    while ( step(f, y, h, tend, n) )
+      ;
+  }
+
+  template <size_t dim>
+  void BatchODESolver<dim>::stage_arg_(const double_t* y, const double_t* c, size_t s, size_t n)
+  {
+    for ( size_t j = 0 ; j < dim * n ; ++j )
+      ytmp_[j] = 0.0;
+
+    for ( size_t r = 0 ; r < s ; ++r )
+    {
+      if ( c[r] == 0.0 )
+        continue;
+      const double_t* k = &k_[r][0];
+      for ( size_t j = 0 ; j < dim * n ; ++j )
+        ytmp_[j] += c[r] * k[j];
+    }
+
+    for ( size_t v = 0 ; v < dim ; ++v )
+      for ( size_t i = 0 ; i < n ; ++i )
+        ytmp_[v*n + i] = y[v*n + i] + hs_[i] * ytmp_[v*n + i];
+  }
+
+  template <size_t dim>
+  template <typename DynamicsT>
+  bool BatchODESolver<dim>::step(const DynamicsT& f, double_t* y, double_t* h,
+                                 double_t tend, size_t n)
+  {
+    // Dormand-Prince coefficients
+    static const double_t a2[] = { 1.0/5.0 };
+    static const double_t a3[] = { 3.0/40.0, 9.0/40.0 };
+    static const double_t a4[] = { 44.0/45.0, -56.0/15.0, 32.0/9.0 };
+    static const double_t a5[] = { 19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0,
+                                   -212.0/729.0 };
+    static const double_t a6[] = { 9017.0/3168.0, -355.0/33.0, 46732.0/5247.0,
+                                   49.0/176.0, -5103.0/18656.0 };
+    static const double_t b5[] = { 35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0,
+                                   -2187.0/6784.0, 11.0/84.0 };
+    // difference of 5th and 4th order weights
+    static const double_t e[] = { 71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0,
+                                  -17253.0/339200.0, 22.0/525.0, -1.0/40.0 };
+
+    assert(t_.size() == n);
+
+    // lanes that have reached tend take steps of zero length
+    bool active = false;
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      hs_[i] = t_[i] < tend ? std::min(h[i], tend - t_[i]) : 0.0;
+      active = active || hs_[i] > 0.0;
+    }
+    if ( not active )
+      return false;
+
+    f(y, &k_[0][0], n);
+    stage_arg_(y, a2, 1, n);
+    f(&ytmp_[0], &k_[1][0], n);
+    stage_arg_(y, a3, 2, n);
+    f(&ytmp_[0], &k_[2][0], n);
+    stage_arg_(y, a4, 3, n);
+    f(&ytmp_[0], &k_[3][0], n);
+    stage_arg_(y, a5, 4, n);
+    f(&ytmp_[0], &k_[4][0], n);
+    stage_arg_(y, a6, 5, n);
+    f(&ytmp_[0], &k_[5][0], n);
+
+    // 5th order solution, the last stage is evaluated there
+    stage_arg_(y, b5, 6, n);
+    ynew_.swap(ytmp_);
+    f(&ynew_[0], &k_[6][0], n);
+
+    // largest scaled error estimate of each lane
+    std::fill(err_.begin(), err_.end(), 0.0);
+    for ( size_t v = 0 ; v < dim ; ++v )
+      for ( size_t i = 0 ; i < n ; ++i )
+      {
+        const size_t j = v*n + i;
+        double_t d = 0.0;
+        for ( size_t s = 0 ; s < 7 ; ++s )
+          d += e[s] * k_[s][j];
+        d = std::fabs(hs_[i] * d) / ( eps_abs_ + eps_rel_ * std::fabs(ynew_[j]) );
+        err_[i] = std::max(err_[i], d);
+      }
+
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      if ( hs_[i] == 0.0 )
+        continue;
+
+      const bool accept = err_[i] <= 1.0 || hs_[i] <= h_min_;
+      const double_t factor =
+        std::min(5.0, std::max(0.2, 0.9 * std::pow(err_[i] + 1.0e-200, -0.2)));
+
+      if ( accept )
+      {
+        for ( size_t v = 0 ; v < dim ; ++v )
+          y[v*n + i] = ynew_[v*n + i];
+        t_[i] = hs_[i] < tend - t_[i] ? t_[i] + hs_[i] : tend;
+
+        // a step shortened to end at tend does not decrease the step size,
+        // unless the error requires it
+        if ( hs_[i] == h[i] || factor < 1.0 )
+          h[i] = hs_[i] * factor;
+      }
+      else
+        h[i] = hs_[i] * factor;
+
+      h[i] = std::max(h[i], h_min_);
+    }
+
+    return true;
+  }
+
+}
+
+#endif // BATCH_ODE_SOLVER_H
@@ -47,6 +47,7 @@ int nest::Communicator::send_buffer_size_ = 1;
 int nest::Communicator::recv_buffer_size_ = 1;
 bool nest::Communicator::initialized_ = false;
 bool nest::Communicator::use_Allgather_ = true;
+bool nest::Communicator::use_Alltoallv_ = false;
 
 #ifdef HAVE_MPI
 
@@ -74,6 +75,12 @@ MPI_Datatype MPI_OFFGRID_SPIKE = 0;
 unsigned int nest::Communicator::COMM_OVERFLOW_ERROR = std::numeric_limits<unsigned int>::max();
 
 std::vector<int> nest::Communicator::comm_step_ = std::vector<int>();
+bool nest::Communicator::nonblocking_pending_ = false;
+
+#if MPI_VERSION >= 3
+// Request handle of the pending non-blocking spike exchange
+MPI_Request spike_request = MPI_REQUEST_NULL;
+#endif
 
 /**
  * Set up MPI and establish number of processes and rank
@@ -260,8 +267,6 @@ void nest::Communicator::communicate_Allgather(std::vector<uint_t>& send_buffer,
 					       std::vector<uint_t>& recv_buffer,
 					       std::vector<int>& displacements)
 {
-  std::vector<int> recv_counts(num_processes_,send_buffer_size_);
-
   //attempt Allgather
   if (send_buffer.size() == static_cast<uint_t>(send_buffer_size_))
     MPI_Allgather(&send_buffer[0], send_buffer_size_, MPI_UNSIGNED,
@@ -275,6 +280,15 @@ void nest::Communicator::communicate_Allgather(std::vector<uint_t>& send_buffer,
       MPI_Allgather(&overflow_buffer[0], send_buffer_size_, MPI_UNSIGNED,
 		    &recv_buffer[0], send_buffer_size_, MPI_UNSIGNED, comm);
     }
+  complete_Allgather_(send_buffer, recv_buffer, displacements);
+}
+
+void nest::Communicator::complete_Allgather_(std::vector<uint_t>& send_buffer,
+					     std::vector<uint_t>& recv_buffer,
+					     std::vector<int>& displacements)
+{
+  std::vector<int> recv_counts(num_processes_,send_buffer_size_);
+
   //check for overflow condition
   int disp = 0;
   uint_t max_recv_count = send_buffer_size_;
@@ -484,7 +498,6 @@ void nest::Communicator::communicate_Allgather(std::vector<OffGridSpike>& send_b
                                                std::vector<OffGridSpike>& recv_buffer,
                                                std::vector<int>& displacements)
 {
-  std::vector<int> recv_counts(num_processes_,send_buffer_size_);
   //attempt Allgather
   if (send_buffer.size() == static_cast<uint_t>(send_buffer_size_))
     MPI_Allgather(&send_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE,
@@ -497,6 +510,14 @@ void nest::Communicator::communicate_Allgather(std::vector<OffGridSpike>& send_b
       MPI_Allgather(&overflow_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE,
 		    &recv_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE, comm);
     }
+  complete_Allgather_(send_buffer, recv_buffer, displacements);
+}
+
+void nest::Communicator::complete_Allgather_(std::vector<OffGridSpike>& send_buffer,
+                                             std::vector<OffGridSpike>& recv_buffer,
+                                             std::vector<int>& displacements)
+{
+  std::vector<int> recv_counts(num_processes_,send_buffer_size_);
 
   //check for overflow condition
   int disp = 0;
@@ -681,6 +702,143 @@ void nest::Communicator::communicate(double_t send_val, std::vector<double_t>& r
 }
 
 
+namespace
+{
+  /**
+   * Alltoallv with receive counts unknown to the receiver. The counts are
+   * exchanged with MPI_Alltoall first, then the payload is transferred.
+   */
+  template <typename T>
+  void communicate_Alltoallv_(std::vector<T>& send_buffer,
+                              std::vector<int>& send_counts,
+                              std::vector<T>& recv_buffer,
+                              std::vector<int>& displacements,
+                              MPI_Datatype type)
+  {
+    const int num_processes = send_counts.size();
+    std::vector<int> send_displacements(num_processes, 0);
+    for ( int pid = 1; pid < num_processes; ++pid )
+      send_displacements[pid] = send_displacements[pid-1] + send_counts[pid-1];
+
+    std::vector<int> recv_counts(num_processes, 0);
+    MPI_Alltoall(&send_counts[0], 1, MPI_INT, &recv_counts[0], 1, MPI_INT, comm);
+
+    displacements.resize(num_processes);
+    displacements[0] = 0;
+    for ( int pid = 1; pid < num_processes; ++pid )
+      displacements[pid] = displacements[pid-1] + recv_counts[pid-1];
+
+    recv_buffer.resize(displacements[num_processes-1] + recv_counts[num_processes-1]);
+
+    // MPI requires valid buffer addresses even if nothing is transferred
+    T dummy;
+    MPI_Alltoallv(send_buffer.empty() ? &dummy : &send_buffer[0],
+                  &send_counts[0], &send_displacements[0], type,
+                  recv_buffer.empty() ? &dummy : &recv_buffer[0],
+                  &recv_counts[0], &displacements[0], type, comm);
+  }
+}
+
+void nest::Communicator::communicate_Alltoallv(std::vector<uint_t>& send_buffer,
+                                               std::vector<int>& send_counts,
+                                               std::vector<uint_t>& recv_buffer,
+                                               std::vector<int>& displacements)
+{
+  assert(send_counts.size() == static_cast<size_t>(num_processes_));
+  communicate_Alltoallv_(send_buffer, send_counts, recv_buffer, displacements, MPI_UNSIGNED);
+}
+
+void nest::Communicator::communicate_Alltoallv(std::vector<OffGridSpike>& send_buffer,
+                                               std::vector<int>& send_counts,
+                                               std::vector<OffGridSpike>& recv_buffer,
+                                               std::vector<int>& displacements)
+{
+  assert(send_counts.size() == static_cast<size_t>(num_processes_));
+  communicate_Alltoallv_(send_buffer, send_counts, recv_buffer, displacements, MPI_OFFGRID_SPIKE);
+}
+
+void nest::Communicator::start_communicate(std::vector<uint_t>& send_buffer,
+                                           std::vector<uint_t>& recv_buffer)
+{
+  assert(!nonblocking_pending_);
+#if MPI_VERSION >= 3
+  if (num_processes_ > 1 && use_Allgather_)
+    {
+      // the overflow message must stay valid until the exchange is complete
+      static std::vector<uint_t> overflow_buffer;
+      if (send_buffer.size() == static_cast<uint_t>(send_buffer_size_))
+	MPI_Iallgather(&send_buffer[0], send_buffer_size_, MPI_UNSIGNED,
+		       &recv_buffer[0], send_buffer_size_, MPI_UNSIGNED, comm, &spike_request);
+      else
+	{
+	  overflow_buffer.assign(send_buffer_size_, 0U);
+	  overflow_buffer[0] = COMM_OVERFLOW_ERROR;
+	  overflow_buffer[1] = send_buffer.size();
+	  MPI_Iallgather(&overflow_buffer[0], send_buffer_size_, MPI_UNSIGNED,
+			 &recv_buffer[0], send_buffer_size_, MPI_UNSIGNED, comm, &spike_request);
+	}
+      nonblocking_pending_ = true;
+    }
+#endif
+}
+
+void nest::Communicator::start_communicate(std::vector<OffGridSpike>& send_buffer,
+                                           std::vector<OffGridSpike>& recv_buffer)
+{
+  assert(!nonblocking_pending_);
+#if MPI_VERSION >= 3
+  if (num_processes_ > 1 && use_Allgather_)
+    {
+      // the overflow message must stay valid until the exchange is complete
+      static std::vector<OffGridSpike> overflow_buffer;
+      if (send_buffer.size() == static_cast<uint_t>(send_buffer_size_))
+	MPI_Iallgather(&send_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE,
+		       &recv_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE, comm, &spike_request);
+      else
+	{
+	  overflow_buffer.assign(send_buffer_size_, OffGridSpike());
+	  overflow_buffer[0] = OffGridSpike(COMM_OVERFLOW_ERROR,0.0);
+	  overflow_buffer[1] = OffGridSpike(send_buffer.size(),0.0);
+	  MPI_Iallgather(&overflow_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE,
+			 &recv_buffer[0], send_buffer_size_, MPI_OFFGRID_SPIKE, comm, &spike_request);
+	}
+      nonblocking_pending_ = true;
+    }
+#endif
+}
+
+void nest::Communicator::finish_communicate(std::vector<uint_t>& send_buffer,
+                                            std::vector<uint_t>& recv_buffer,
+                                            std::vector<int>& displacements)
+{
+  if (!nonblocking_pending_)
+    {
+      communicate(send_buffer, recv_buffer, displacements);
+      return;
+    }
+#if MPI_VERSION >= 3
+  MPI_Wait(&spike_request, MPI_STATUS_IGNORE);
+#endif
+  nonblocking_pending_ = false;
+  complete_Allgather_(send_buffer, recv_buffer, displacements);
+}
+
+void nest::Communicator::finish_communicate(std::vector<OffGridSpike>& send_buffer,
+                                            std::vector<OffGridSpike>& recv_buffer,
+                                            std::vector<int>& displacements)
+{
+  if (!nonblocking_pending_)
+    {
+      communicate(send_buffer, recv_buffer, displacements);
+      return;
+    }
+#if MPI_VERSION >= 3
+  MPI_Wait(&spike_request, MPI_STATUS_IGNORE);
+#endif
+  nonblocking_pending_ = false;
+  complete_Allgather_(send_buffer, recv_buffer, displacements);
+}
+
 /**
  * communicate function for sending set-up information
  */
@@ -1076,6 +1234,32 @@ void nest::Communicator::communicate(std::vector<OffGridSpike>& send_buffer,
   recv_buffer.swap(send_buffer);
 }
 
+/**
+ * Alltoallv (on-grid) if compiled without MPI
+ */
+void nest::Communicator::communicate_Alltoallv(std::vector<uint_t>& send_buffer,
+                                               std::vector<int>&,
+                                               std::vector<uint_t>& recv_buffer,
+                                               std::vector<int>& displacements)
+{
+  displacements.resize(1);
+  displacements[0] = 0;
+  recv_buffer.swap(send_buffer);
+}
+
+/**
+ * Alltoallv (off-grid) if compiled without MPI
+ */
+void nest::Communicator::communicate_Alltoallv(std::vector<OffGridSpike>& send_buffer,
+                                               std::vector<int>&,
+                                               std::vector<OffGridSpike>& recv_buffer,
+                                               std::vector<int>& displacements)
+{
+  displacements.resize(1);
+  displacements[0] = 0;
+  recv_buffer.swap(send_buffer);
+}
+
 void nest::Communicator::communicate(std::vector<double_t>& send_buffer,
                                      std::vector<double_t>& recv_buffer,
                                      std::vector<int>& displacements)
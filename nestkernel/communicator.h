@@ -169,6 +169,45 @@ public:
   static void communicate(std::vector<int_t>&);
   static void communicate(std::vector<long_t>&);
 
+  /**
+   * Send an individual block of entries to each process.
+   * The first send_counts[0] entries of send_buffer go to rank 0, the
+   * next send_counts[1] entries to rank 1, and so on. On return,
+   * recv_buffer contains the blocks received from all ranks in order of
+   * rank and displacements[r] gives the start of the block from rank r.
+   */
+  static void communicate_Alltoallv(std::vector<uint_t>& send_buffer,
+                                    std::vector<int>& send_counts,
+                                    std::vector<uint_t>& recv_buffer,
+                                    std::vector<int>& displacements);
+  static void communicate_Alltoallv(std::vector<OffGridSpike>& send_buffer,
+                                    std::vector<int>& send_counts,
+                                    std::vector<OffGridSpike>& recv_buffer,
+                                    std::vector<int>& displacements);
+
+  /**
+   * Start exchanging spikes with a non-blocking MPI_Iallgather. The
+   * exchange must be completed by finish_communicate() before the
+   * buffers are used again. If non-blocking collectives are not
+   * available or spikes are not exchanged with Allgather, all
+   * communication takes place in finish_communicate().
+   */
+  static void start_communicate(std::vector<uint_t>& send_buffer,
+                                std::vector<uint_t>& recv_buffer);
+  static void start_communicate(std::vector<OffGridSpike>& send_buffer,
+                                std::vector<OffGridSpike>& recv_buffer);
+
+  /**
+   * Complete an exchange started with start_communicate(). On return,
+   * the buffers are in the same state as after communicate().
+   */
+  static void finish_communicate(std::vector<uint_t>& send_buffer,
+                                 std::vector<uint_t>& recv_buffer,
+                                 std::vector<int>& displacements);
+  static void finish_communicate(std::vector<OffGridSpike>& send_buffer,
+                                 std::vector<OffGridSpike>& recv_buffer,
+                                 std::vector<int>& displacements);
+
   /**
    * Collect GIDs for all nodes in a given node list across processes.
    * The NodeListType should be one of LocalNodeList, LocalLeafList, LocalChildList.
@@ -206,11 +245,13 @@ public:
   static int get_send_buffer_size();
   static int get_recv_buffer_size();
   static bool get_use_Allgather();
+  static bool get_use_Alltoallv();
   static bool get_initialized();
    
   static void set_num_threads(thread num_threads);
   static void set_buffer_sizes(int send_buffer_size, int recv_buffer_size);
   static void set_use_Allgather(bool use_Allgather);
+  static void set_use_Alltoallv(bool use_Alltoallv);
 
 private:
 
@@ -223,9 +264,11 @@ private:
   static int recv_buffer_size_;  //!< size of receive buffer
   static bool initialized_;      //!< whether MPI is initialized
   static bool use_Allgather_;    //!< using Allgather communication
+  static bool use_Alltoallv_;    //!< sending spikes only to ranks with targets via Alltoallv
   
   static std::vector<int> comm_step_;  //!< array containing communication partner for each step.
   static uint_t COMM_OVERFLOW_ERROR;
+  static bool nonblocking_pending_;    //!< a non-blocking spike exchange has been started
 
   static void init_communication();
 
@@ -238,6 +281,18 @@ private:
   static void communicate_Allgather(std::vector<int_t>&);
   static void communicate_Allgather(std::vector<long_t>&);
 
+  /**
+   * Check for overflow after a spike buffer has been gathered from
+   * all processes and transmit the complete buffers with Allgatherv
+   * if necessary.
+   */
+  static void complete_Allgather_(std::vector<uint_t>& send_buffer,
+                                  std::vector<uint_t>& recv_buffer,
+                                  std::vector<int>& displacements);
+  static void complete_Allgather_(std::vector<OffGridSpike>& send_buffer,
+                                  std::vector<OffGridSpike>& recv_buffer,
+                                  std::vector<int>& displacements);
+
   template <typename T>
   static void communicate_Allgatherv(std::vector<T>& send_buffer,
                                      std::vector<T>& recv_buffer,
@@ -332,6 +387,30 @@ public:
   static void communicate(std::vector<int_t>&) {}
   static void communicate(std::vector<long_t>&) {}
 
+  static void communicate_Alltoallv(std::vector<uint_t>& send_buffer,
+                                    std::vector<int>& send_counts,
+                                    std::vector<uint_t>& recv_buffer,
+                                    std::vector<int>& displacements);
+  static void communicate_Alltoallv(std::vector<OffGridSpike>& send_buffer,
+                                    std::vector<int>& send_counts,
+                                    std::vector<OffGridSpike>& recv_buffer,
+                                    std::vector<int>& displacements);
+
+  static void start_communicate(std::vector<uint_t>&, std::vector<uint_t>&) {}
+  static void start_communicate(std::vector<OffGridSpike>&, std::vector<OffGridSpike>&) {}
+  static void finish_communicate(std::vector<uint_t>& send_buffer,
+                                 std::vector<uint_t>& recv_buffer,
+                                 std::vector<int>& displacements)
+  {
+    communicate(send_buffer, recv_buffer, displacements);
+  }
+  static void finish_communicate(std::vector<OffGridSpike>& send_buffer,
+                                 std::vector<OffGridSpike>& recv_buffer,
+                                 std::vector<int>& displacements)
+  {
+    communicate(send_buffer, recv_buffer, displacements);
+  }
+
    /**
    * Collect GIDs for all nodes in a given node list across processes.
    * The NodeListType should be one of LocalNodeList, LocalLeafList, LocalChildList.
@@ -374,11 +453,13 @@ public:
   static int get_send_buffer_size();
   static int get_recv_buffer_size();
   static bool get_use_Allgather();
+  static bool get_use_Alltoallv();
   static bool get_initialized();
 
   static void set_num_threads(thread num_threads);
   static void set_buffer_sizes(int send_buffer_size, int recv_buffer_size);
   static void set_use_Allgather(bool use_Allgather);
+  static void set_use_Alltoallv(bool use_Alltoallv);
 
 private:
 
@@ -391,6 +472,7 @@ private:
   static int recv_buffer_size_;  //!< size of receive buffer
   static bool initialized_;      //!< whether MPI is initialized
   static bool use_Allgather_;    //!< using Allgather communication
+  static bool use_Alltoallv_;    //!< sending spikes only to ranks with targets via Alltoallv
 };
 
 inline void Communicator::set_use_Allgather(bool use_Allgather)
@@ -448,6 +530,16 @@ inline bool Communicator::get_use_Allgather()
   return use_Allgather_;
 }
 
+inline bool Communicator::get_use_Alltoallv()
+{
+  return use_Alltoallv_;
+}
+
+inline void Communicator::set_use_Alltoallv(bool use_Alltoallv)
+{
+  use_Alltoallv_ = use_Alltoallv;
+}
+
 inline bool Communicator::get_initialized()
 {
   return initialized_;
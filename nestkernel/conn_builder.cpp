@@ -35,7 +35,10 @@
 #include "normal_randomdev.h"
 #include "gslrandomgen.h"
 #include "fdstream.h"
+#include "philox.h"
 
+#include <algorithm>
+#include <cmath>
 #include <set>
 #ifdef _OPENMP
 #include <omp.h>
@@ -53,6 +56,10 @@ nest::ConnBuilder::ConnBuilder(Network& net,
     autapses_(true),
     multapses_(true),
     exceptions_raised_(net_.get_num_threads()),
+    rng_purpose_(net_.new_rng_purpose()),
+    bulk_connect_(false),
+    staged_(net_.get_num_threads()),
+    staged_params_(net_.get_num_threads()),
     synapse_model_(net_.get_synapsedict()["static_synapse"]),
     weight_(0),
     delay_(0),
@@ -63,6 +70,7 @@ nest::ConnBuilder::ConnBuilder(Network& net,
   //  - rule-specific params are handled by subclass c'tor
   updateValue<bool>(conn_spec, names::autapses, autapses_);
   updateValue<bool>(conn_spec, names::multapses, multapses_);
+  updateValue<bool>(conn_spec, Name("bulk_connect"), bulk_connect_);
 
   // read out synapse-related parameters ----------------------
   if ( !syn_spec->known(names::model) )
@@ -251,6 +259,9 @@ void nest::ConnBuilder::connect()
 {
   connect_();
 
+  if ( bulk_connect_ )
+    create_staged_connections_();
+
   // check if any exceptions have been raised
   for ( thread thr = 0 ; thr < net_.get_num_threads() ; ++thr )
     if ( exceptions_raised_.at(thr).valid() )
@@ -262,22 +273,7 @@ void nest::ConnBuilder::single_connect_(index sgid,
 					Node& target, thread target_thread, librandom::RngPtr& rng)
 {
   index tgid = target.get_gid();
-  if ( param_dicts_.empty() )  // indicates we have no synapse params
-  {
-    if ( default_weight_and_delay_ )
-      net_.connect(sgid, &target, target_thread, synapse_model_);
-    else if (default_weight_)
-      net_.connect(sgid, &target, target_thread, synapse_model_,
-		   delay_->value_double(sgid, tgid, rng));
-    else
-    {
-      double delay = delay_->value_double(sgid, tgid, rng);
-      double weight = weight_->value_double(sgid, tgid, rng);
-      net_.connect(sgid, &target, target_thread, synapse_model_,
-		   delay, weight);
-    }
-  }
-  else
+  if ( not param_dicts_.empty() )
   {
     assert(net_.get_num_threads() == static_cast<thread>(param_dicts_.size()));
 
@@ -287,39 +283,156 @@ void nest::ConnBuilder::single_connect_(index sgid,
     {
       if ( it->first == names::receptor_type || it->first == names::music_channel )
       {
+        long_t rtype;
         try
 	{
-	  // change value of dictionary entry without allocating new datum
-	  IntegerDatum *id = static_cast<IntegerDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
-	  (*id) = it->second->value_int(sgid, tgid, rng);
+	  rtype = it->second->value_int(sgid, tgid, rng);
         }
         catch(KernelException& e)
 	{
           throw BadProperty("Receptor type must be of type integer.");
 	}
+        if ( bulk_connect_ )
+          staged_params_[target_thread].push_back(rtype);
+        else
+        {
+	  // change value of dictionary entry without allocating new datum
+	  IntegerDatum *id = static_cast<IntegerDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
+	  (*id) = rtype;
+        }
       }
       else
       {
-	// change value of dictionary entry without allocating new datum
-	DoubleDatum *dd = static_cast<DoubleDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
-        (*dd) = it->second->value_double(sgid, tgid, rng);
+        const double_t value = it->second->value_double(sgid, tgid, rng);
+        if ( bulk_connect_ )
+          staged_params_[target_thread].push_back(value);
+        else
+        {
+	  // change value of dictionary entry without allocating new datum
+	  DoubleDatum *dd = static_cast<DoubleDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
+          (*dd) = value;
+        }
       }  
     }
+  }
+
+  // NAN indicates that the default is used, see Network::connect()
+  double_t delay = NAN;
+  double_t weight = NAN;
+  if ( not default_weight_and_delay_ )
+    delay = delay_->value_double(sgid, tgid, rng);
+  if ( not default_weight_ )
+    weight = weight_->value_double(sgid, tgid, rng);
+
+  if ( bulk_connect_ )
+    staged_[target_thread].push_back(StagedConnection(sgid, &target, delay, weight));
+  else
+    create_connection_(sgid, target, target_thread, delay, weight);
+}
+
+inline
+void nest::ConnBuilder::create_connection_(index sgid, Node& target, thread target_thread,
+					   double_t delay, double_t weight)
+{
+  if ( param_dicts_.empty() )  // indicates we have no synapse params
+    net_.connect(sgid, &target, target_thread, synapse_model_, delay, weight);
+  else
+    net_.connect(sgid, &target, target_thread, synapse_model_,
+		 param_dicts_[target_thread], delay, weight);
+}
+
+void nest::ConnBuilder::connect_grouped_(std::vector<std::pair<index, index> >& conns,
+                                         thread tid, librandom::RngPtr& rng)
+{
+  std::sort(conns.begin(), conns.end());
+
+  for ( size_t first = 0; first < conns.size(); )
+  {
+    const index sgid = conns[first].first;
+    size_t last = first;
+    while ( last < conns.size() && conns[last].first == sgid )
+      ++last;
 
-    if ( default_weight_and_delay_ )
-      net_.connect(sgid, &target, target_thread, synapse_model_, 
-		   param_dicts_[target_thread]);
-    else if ( default_weight_ )
-      net_.connect(sgid, &target, target_thread, synapse_model_, 
-		   param_dicts_[target_thread],
-		   delay_->value_double(sgid, tgid, rng));
-    else
+    bool reserved = false;
+    for ( size_t i = first; i < last; ++i )
     {
-      double delay = delay_->value_double(sgid, tgid, rng);
-      double weight = weight_->value_double(sgid, tgid, rng);
-      net_.connect(sgid, &target, target_thread, synapse_model_,
-		   param_dicts_[target_thread], delay, weight);
+      single_connect_(sgid, *net_.get_node(conns[i].second), tid, rng);
+
+      // once the connector of the source can grow in place, make
+      // room for all its remaining connections at once
+      if ( not bulk_connect_ && not reserved && i + 1 < last )
+        reserved = net_.reserve_connections(sgid, tid, synapse_model_, last - i - 1);
+    }
+
+    first = last;
+  }
+}
+
+void nest::ConnBuilder::create_staged_connections_()
+{
+  #pragma omp parallel
+  {
+    // get thread id
+    const int tid = net_.get_thread_id();
+
+    try
+    {
+      const std::vector<StagedConnection>& staged = staged_[tid];
+      const std::vector<double_t>& params = staged_params_[tid];
+      const size_t n_params = synapse_params_.size();
+
+      // sort by source, keeping connections of each source in the
+      // order they were drawn in, so that the result does not differ
+      // from creating connections immediately
+      std::vector<std::pair<index, size_t> > order(staged.size());
+      for ( size_t i = 0; i < staged.size(); ++i )
+        order[i] = std::make_pair(staged[i].sgid, i);
+      std::sort(order.begin(), order.end());
+
+      for ( size_t first = 0; first < order.size(); )
+      {
+        const index sgid = order[first].first;
+        size_t last = first;
+        while ( last < order.size() && order[last].first == sgid )
+          ++last;
+
+        bool reserved = false;
+        for ( size_t i = first; i < last; ++i )
+        {
+          const StagedConnection& c = staged[order[i].second];
+
+          if ( n_params > 0 )
+          {
+            std::vector<double_t>::const_iterator value = params.begin() + order[i].second * n_params;
+            for ( ConnParameterMap::const_iterator it = synapse_params_.begin() ;
+                  it != synapse_params_.end(); 
+                  ++it, ++value )
+              if ( it->first == names::receptor_type || it->first == names::music_channel )
+                *static_cast<IntegerDatum *>(((*param_dicts_[tid])[it->first]).datum()) = static_cast<long_t>(*value);
+              else
+                *static_cast<DoubleDatum *>(((*param_dicts_[tid])[it->first]).datum()) = *value;
+          }
+
+          create_connection_(sgid, *c.target, tid, c.delay, c.weight);
+
+          // once the connector of the source can grow in place, make
+          // room for all its remaining connections at once
+          if ( not reserved && i + 1 < last )
+            reserved = net_.reserve_connections(sgid, tid, synapse_model_, last - i - 1);
+        }
+
+        first = last;
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at(tid) = lockPTR<WrappedThreadException>(new WrappedThreadException(err));
     }
+
+    std::vector<StagedConnection>().swap(staged_[tid]);
+    std::vector<double_t>().swap(staged_params_[tid]);
   }
 }
 
@@ -363,6 +476,9 @@ void nest::OneToOneBuilder::connect_()
         if( tid != target_thread)
           continue;
 
+        // with vp_independent_rng, draw from the stream of this target
+        rng = net_.get_stream_rng(tid, 0, *tgid, rng_purpose_);
+
         single_connect_(*sgid, *target, target_thread, rng);
       }
     }
@@ -405,6 +521,9 @@ void nest::AllToAllBuilder::connect_()
         if( tid != target_thread)
           continue;
 
+        // with vp_independent_rng, draw from the stream of this target
+        rng = net_.get_stream_rng(tid, 0, *tgid, rng_purpose_);
+
         for ( GIDCollection::const_iterator 
  	      sgid = sources_.begin();
 	      sgid != sources_.end();
@@ -475,6 +594,9 @@ void nest::FixedInDegreeBuilder::connect_()
         if( tid != target_thread)
           continue;
 
+        // with vp_independent_rng, draw from the stream of this target
+        rng = net_.get_stream_rng(tid, 0, *tgid, rng_purpose_);
+
         std::set<long> ch_ids;
         long n_rnd = sources_.size();
 
@@ -528,75 +650,115 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder(Network& net,
 
 void nest::FixedOutDegreeBuilder::connect_()
 {
-  librandom::RngPtr grng = net_.get_grng();
+  // The targets of each source are drawn from a counter-based stream
+  // given by a seed and the source. All processes draw the same seed
+  // from the global RNG, which thus stays synchronized, and obtain the
+  // same targets for each source, no matter which thread draws them.
+  const unsigned long seed = net_.get_grng()->ulrand(0xffffffffUL);
+
+  // Sources are handled in blocks: first, each thread draws the targets
+  // of every n_threads-th source of the block, then each thread creates
+  // the connections to its targets, in the order of a serial run.
+  const size_t n_sources = sources_.size();
+  const size_t n_threads = net_.get_num_threads();
+  const size_t block_size = std::max(n_threads,
+    static_cast<size_t>(1 << 20) / std::max(outdegree_, 1L));
+  std::vector<std::vector<std::pair<index, index> > > tgt_ids(std::min(block_size, n_sources));
 
-  for (GIDCollection::const_iterator 
-       sgid = sources_.begin();
-       sgid != sources_.end();
-       ++sgid 
-       )
-    { 
-      std::set<long> ch_ids;
-      std::vector<index> tgt_ids_;
-      const long n_rnd = targets_.size();
-      
-      for ( long j = 0; j < outdegree_ ; ++j )
-        {
-	  unsigned long t_id;
-	  index tgid;
-	  
-	  do 
-            {
-              t_id  = grng->ulrand(n_rnd);
-              tgid = targets_[t_id];
-            }
-	    while (( not autapses_ and tgid == *sgid ) ||
-	       	   ( not multapses_ and ch_ids.find( t_id ) != ch_ids.end()));
+  #pragma omp parallel
+  {
+    // get thread id
+    const int tid = net_.get_thread_id();
 
-          if (not multapses_)
-            ch_ids.insert(t_id);
-	  
-	  tgt_ids_.push_back(tgid);
-	 }
-      
-    #pragma omp parallel
+    // allocate pointer to thread specific random generator
+    librandom::RngPtr rng = net_.get_rng(tid);
+    librandom::PhiloxRandomGen stream_rng(seed);
+
+    // all threads must pass all barriers, so we only stop connecting
+    // after an exception
+    bool failed = false;
+
+    for ( size_t block = 0 ; block < n_sources ; block += block_size )
+    {
+      const size_t block_end = std::min(block + block_size, n_sources);
+
+      for ( size_t s = block + tid ; s < block_end ; s += n_threads )
       {
-        // get thread id
-        const int tid = net_.get_thread_id();
+        stream_rng.set_stream(seed, sources_[s], 0, rng_purpose_);
+        tgt_ids[s - block].clear();
+        draw_targets_(sources_[s], stream_rng, tgt_ids[s - block]);
+      }
+
+      #pragma omp barrier
 
+      if ( !failed )
+      {
         try
-	{
-          // allocate pointer to thread specific random generator
-          librandom::RngPtr rng = net_.get_rng(tid);
-
-          for (std::vector<index>::const_iterator 
-               tgid = tgt_ids_.begin();
-               tgid != tgt_ids_.end();
-               ++tgid 
-               )
+        {
+          for ( size_t s = block ; s < block_end ; ++s )
+          {
+            const std::vector<std::pair<index, index> >& tgids = tgt_ids[s - block];
+            for ( std::vector<std::pair<index, index> >::const_iterator tgid = tgids.begin();
+                  tgid != tgids.end();
+                  ++tgid )
             {
-              // check whether the target is on this mpi machine
-              if (!net_.is_local_gid(*tgid))
-                continue;
-
-              Node * const target = net_.get_node(*tgid);
+              Node * const target = net_.get_node(tgid->first);
               const thread target_thread = target->get_thread();
 
-	      // check whether the target is on our thread  
+              // check whether the target is on our thread
               if( tid != target_thread)
                 continue;
 
-              single_connect_(*sgid, *target, target_thread, rng);
+              // with vp_independent_rng, draw the parameters from the stream
+              // of the source and the number of the draw, which also tells
+              // multapses apart
+              rng = net_.get_stream_rng(tid, sources_[s], tgid->second, rng_purpose_);
+
+              single_connect_(sources_[s], *target, target_thread, rng);
             }
+          }
         }
         catch ( std::exception& err )
         {
           // We must create a new exception here, err's lifetime ends at
           // the end of the catch block.
           exceptions_raised_.at(tid) = lockPTR<WrappedThreadException>(new WrappedThreadException(err));
+          failed = true;
         }
-      }  
-    }  
+      }
+
+      // tgt_ids is overwritten by the next block
+      #pragma omp barrier
+    }
+  }
+}
+
+void nest::FixedOutDegreeBuilder::draw_targets_(index sgid, librandom::RandomGen& rng,
+                                                std::vector<std::pair<index, index> >& tgids) const
+{
+  std::set<long> ch_ids;
+  const long n_rnd = targets_.size();
+
+  for ( long j = 0; j < outdegree_ ; ++j )
+  {
+    unsigned long t_id;
+    index tgid;
+
+    do
+    {
+      t_id  = rng.ulrand(n_rnd);
+      tgid = targets_[t_id];
+    }
+    while (( not autapses_ and tgid == sgid ) ||
+           ( not multapses_ and ch_ids.find( t_id ) != ch_ids.end()));
+
+    if (not multapses_)
+      ch_ids.insert(t_id);
+
+    // only targets on this mpi machine are connected here
+    if (net_.is_local_gid(tgid))
+      tgids.push_back(std::make_pair(tgid, static_cast<index>(j)));
+  }
 }
 
 nest::FixedTotalNumberBuilder::FixedTotalNumberBuilder(Network& net,
@@ -632,13 +794,12 @@ void nest::FixedTotalNumberBuilder::connect_()
   const long_t size_sources = sources_.size();
   const long_t size_targets = targets_.size();
 
-  // drawing connection ids
-
-  // Compute the distribution of targets over processes using the modulo function
-  std::vector<std::vector<size_t> > targets_on_vp(M);
+  // Count the targets on each virtual process. Each thread collects
+  // the targets of its own virtual process below.
+  std::vector<size_t> n_targets_on_vp(M, 0);
   for (size_t t = 0; t < targets_.size(); t++)
   {
-    targets_on_vp[net_.suggest_vp(targets_[t])].push_back(targets_[t]);
+    ++n_targets_on_vp[net_.suggest_vp(targets_[t])];
   }
   	
   // We use the multinomial distribution to determine the number of
@@ -649,10 +810,13 @@ void nest::FixedTotalNumberBuilder::connect_()
   // processes is the total number of edges.
   // To obtain the num_conns_on_vp we adapt the gsl
   // implementation of the multinomial distribution.
+  // All processes compute the split for all virtual processes from
+  // the global rng, so that they agree on it and the global rng stays
+  // synchronized.
 
   // K from gsl is equivalent to M = n_vps
   // N is already taken from stack
-  // p[] is targets_on_vp
+  // p[] is n_targets_on_vp
   std::vector<long_t> num_conns_on_vp (M, 0); // corresponds to n[]
 
   // calculate exact multinomial distribution
@@ -673,16 +837,16 @@ void nest::FixedTotalNumberBuilder::connect_()
 
   for (int k = 0; k < M; k++ )
   {
-    if (targets_on_vp[k].size() > 0)
+    if (n_targets_on_vp[k] > 0)
     {
-      double_t num_local_targets = static_cast<double_t> (targets_on_vp[k].size());
+      double_t num_local_targets = static_cast<double_t> (n_targets_on_vp[k]);
       double_t p_local = num_local_targets / (size_targets - sum_dist);
       bino.set_p(p_local);
       bino.set_n(N_ - sum_partitions);
       num_conns_on_vp[k] = bino.ldev();
     }
 	
-    sum_dist += static_cast<double_t> (targets_on_vp[k].size());
+    sum_dist += static_cast<double_t> (n_targets_on_vp[k]);
     sum_partitions += static_cast<uint_t> (num_conns_on_vp[k]);
   } 
        
@@ -702,29 +866,45 @@ void nest::FixedTotalNumberBuilder::connect_()
       {
         librandom::RngPtr rng = net_.get_rng(tid);
 
-        while( num_conns_on_vp[vp_id] > 0 )
+        // targets on this virtual process
+        std::vector<index> vp_targets;
+        vp_targets.reserve(n_targets_on_vp[vp_id]);
+        for (size_t t = 0; t < targets_.size(); t++)
+          if (net_.suggest_vp(targets_[t]) == vp_id)
+            vp_targets.push_back(targets_[t]);
+
+        // Draw the connections in chunks and create those of each chunk
+        // grouped by source. The chunks bound the memory needed.
+        const long_t chunk_size = 1 << 20;
+        std::vector<std::pair<index, index> > conns;
+        long_t remaining = num_conns_on_vp[vp_id];
+
+        while( remaining > 0 )
         {
+          const long_t n_draws = std::min(remaining, chunk_size);
+          conns.clear();
+          conns.reserve(n_draws);
 
-          // draw random numbers for source node from all source neurons
-          const long_t s_index  = rng->ulrand(size_sources);
-          // draw random numbers for target node from
-          // targets_on_vp on this virtual process
-          const long_t t_index  = rng->ulrand(targets_on_vp[vp_id].size());
-          // map random number of source node to gid corresponding to
-          // the source_adr vector
-          const long_t sgid = sources_[s_index];
-          // map random number of target node to gid using the
-          // targets_on_vp vector
-          const long_t tgid = targets_on_vp[vp_id][t_index];
-
-          Node * const target = net_.get_node(tgid);
-          const thread target_thread = target->get_thread();
-
-          if ( autapses_ or sgid != tgid )
+          for ( long_t i = 0; i < n_draws; ++i )
           {
-            single_connect_(sgid, *target, target_thread, rng);
-            num_conns_on_vp[vp_id]--;
+            // draw random numbers for source node from all source neurons
+            const long_t s_index  = rng->ulrand(size_sources);
+            // draw random numbers for target node from
+            // the targets on this virtual process
+            const long_t t_index  = rng->ulrand(vp_targets.size());
+            // map random number of source node to gid corresponding to
+            // the source_adr vector
+            const index sgid = sources_[s_index];
+            // map random number of target node to gid using the
+            // vp_targets vector
+            const index tgid = vp_targets[t_index];
+
+            if ( autapses_ or sgid != tgid )
+              conns.push_back(std::make_pair(sgid, tgid));
           }
+
+          remaining -= conns.size();
+          connect_grouped_(conns, tid, rng);
         }
       }
     }
@@ -745,7 +925,8 @@ nest::BernoulliBuilder::BernoulliBuilder(Network& net,
 					 const DictionaryDatum& syn_spec
                                          )
   : ConnBuilder(net, sources, targets, conn_spec, syn_spec),
-    p_((*conn_spec)[Name("p")])
+    p_((*conn_spec)[Name("p")]),
+    log_q_(std::log(1.0 - p_))
 {}
 
 
@@ -761,6 +942,8 @@ void nest::BernoulliBuilder::connect_()
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = net_.get_rng(tid);
 
+      const long n_sources = sources_.size();
+
       for (GIDCollection::const_iterator 
            tgid = targets_.begin();
            tgid != targets_.end();
@@ -778,21 +961,22 @@ void nest::BernoulliBuilder::connect_()
         if( tid != target_thread)
           continue;
 
-        for ( GIDCollection::const_iterator 
-              sgid = sources_.begin();
-              sgid != sources_.end();
-              ++sgid )
+        // with vp_independent_rng, draw from the stream of this target
+        rng = net_.get_stream_rng(tid, 0, *tgid, rng_purpose_);
+
+        for ( long j = next_source_(-1, n_sources, rng) ;
+              j < n_sources ;
+              j = next_source_(j, n_sources, rng) )
           {
             // not possible to create multapses with this implementation,
             // hence leave out the check for BernoulliBuilder
 
-            if (not autapses_ and *sgid == *tgid)
+            // the trial for an autapse is drawn, but discarded
+            const index sgid = sources_[j];
+            if (not autapses_ and sgid == *tgid)
               continue;
 
-            if (not ( rng->drand() < p_ ))
-              continue;
-
-            single_connect_(*sgid, *target, target_thread, rng);
+            single_connect_(sgid, *target, target_thread, rng);
           }
       }
     }
@@ -805,3 +989,15 @@ void nest::BernoulliBuilder::connect_()
   }
 }
 
+long nest::BernoulliBuilder::next_source_(long j, long n, librandom::RngPtr& rng) const
+{
+  if ( p_ <= 0.0 )
+    return n;
+  if ( p_ >= 1.0 )
+    return j + 1;
+
+  // 1 - drand() lies in (0, 1], so the logarithm is finite
+  const double_t skip = std::floor(std::log(1.0 - rng->drand()) / log_q_);
+  return skip < n - j - 1 ? j + 1 + static_cast<long>(skip) : n;
+}
+
@@ -83,9 +83,24 @@ namespace nest {
     //! Implements the actual connection algorithm
     virtual void connect_() =0;
 
-    //! Create connection between given nodes, fill parameter values
+    /**
+     * Create connection between given nodes, fill parameter values.
+     * With bulk_connect, parameter values are drawn here, but the
+     * connection is only staged and later created by
+     * create_staged_connections_().
+     */
     void single_connect_(index, Node&, thread, librandom::RngPtr&);
 
+    /**
+     * Create connections for the given (source, target) GID pairs, all
+     * with targets on thread tid, by calling single_connect_(). The
+     * pairs are sorted first, so that the connections of each source
+     * are created in a row and its connector can make room for all of
+     * them at once.
+     */
+    void connect_grouped_(std::vector<std::pair<index, index> >& conns, thread tid,
+                          librandom::RngPtr& rng);
+
     Network& net_;
 
     const GIDCollection& sources_;
@@ -97,9 +112,39 @@ namespace nest {
     //! buffer for exceptions raised in threads
     std::vector<lockPTR<WrappedThreadException> > exceptions_raised_;
 
+    //! purpose for Network::get_stream_rng(), one per Connect call
+    const ulong_t rng_purpose_;
+
   private:
     typedef std::map<Name, ConnParameter*> ConnParameterMap;
 
+    //! Connection drawn by single_connect_(), to be created later
+    struct StagedConnection
+    {
+      StagedConnection(index s, Node* t, double_t d, double_t w)
+        : sgid(s), target(t), delay(d), weight(w) {}
+      index sgid;
+      Node* target;
+      double_t delay;   //!< NAN if default is used
+      double_t weight;  //!< NAN if default is used
+    };
+
+    //! Create all staged connections, grouped by source
+    void create_staged_connections_();
+
+    //! Create connection with given weight and delay, and synapse
+    //! parameters in param_dicts_[target_thread]
+    void create_connection_(index, Node&, thread, double_t, double_t);
+
+    //! stage connections and create them per source after connect_()
+    bool bulk_connect_;
+
+    //! staged connections, one vector per thread
+    std::vector<std::vector<StagedConnection> > staged_;
+
+    //! values of synapse_params_ for each staged connection, one vector per thread
+    std::vector<std::vector<double_t> > staged_params_;
+
     index synapse_model_;
 
     //! indicate that weight and delay should not be set per synapse
@@ -184,6 +229,13 @@ namespace nest {
     void connect_();
 
   private:
+    /**
+     * Draw the targets of a source from rng, appending those on this
+     * process to tgids, each with the number of the draw that gave it.
+     */
+    void draw_targets_(index sgid, librandom::RandomGen& rng,
+                       std::vector<std::pair<index, index> >& tgids) const;
+
     long outdegree_;   
   };
 
@@ -216,7 +268,16 @@ namespace nest {
     void connect_();
 
   private:
-    double p_;   //!< connection probability
+    /**
+     * Return the index of the next source to connect after source j,
+     * or n if there is none among the n sources. The number of sources
+     * skipped is geometrically distributed, so that only one random
+     * number is drawn per connection.
+     */
+    long next_source_(long j, long n, librandom::RngPtr& rng) const;
+
+    double p_;      //!< connection probability
+    double log_q_;  //!< log(1 - p_)
   };
 
   
@@ -75,6 +75,11 @@ namespace nest
      */
     virtual size_t number_of_values() const { return 0; }
 
+    /**
+     * Returns true if values are drawn from the RNG.
+     */
+    virtual bool is_random() const { return false; }
+
     static ConnParameter* create(const Token&);
   };
 
@@ -162,6 +167,8 @@ namespace nest
     double value_double(index, index, librandom::RngPtr& rng) const { return (*rdv_)(rng); }
     long_t value_int(index, index, librandom::RngPtr& rng) const { return (*rdv_)(rng); }
 
+    bool is_random() const { return true; }
+
   private:
     librandom::RdvPtr rdv_;
   };
@@ -155,6 +155,13 @@ class Connection
   Node *get_target(thread t) const { return target_.get_target_ptr(t); }
   rport get_rport() const { return target_.get_rport(); }
 
+  /**
+   * Get and set the target identifier, for connectors that store
+   * targets separately from the other properties of connections.
+   */
+  const targetidentifierT& get_target_identifier() const { return target_; }
+  void set_target_identifier(const targetidentifierT& target) { target_ = target; }
+
 protected:
 
   /**
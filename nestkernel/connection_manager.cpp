@@ -35,7 +35,8 @@ namespace nest
 {
 
 ConnectionManager::ConnectionManager(Network& net)
-        : net_(net)
+        : net_(net),
+          connectivity_changed_(true)
 {}
 
 ConnectionManager::~ConnectionManager()
@@ -77,6 +78,7 @@ void ConnectionManager::init_()
   connections_.swap(tmp);
 
   num_connections_ = 0;
+  connectivity_changed_ = true;
 }
 
 void ConnectionManager::delete_connections_()
@@ -227,6 +229,33 @@ void ConnectionManager::get_status(DictionaryDatum& d) const
 {
   size_t n = get_num_connections();
   def<long>(d, "num_connections", n);
+
+  // memory used by the connectors of each synapse type, in bytes
+  std::vector<size_t> mem(prototypes_[0].size(), 0);
+  for (tVSConnector::const_iterator it = connections_.begin(); it != connections_.end(); ++it)
+    for (tSConnector::const_nonempty_iterator iit = it->nonempty_begin(); iit != it->nonempty_end(); ++iit)
+      (*iit)->get_memory(mem);
+
+  DictionaryDatum connector_memory(new Dictionary());
+  for (synindex syn_id = 0; syn_id < mem.size(); ++syn_id)
+    def<long>(connector_memory, prototypes_[0][syn_id]->get_name(), mem[syn_id]);
+  (*d)["connector_memory"] = connector_memory;
+}
+
+bool ConnectionManager::reserve_connections(index sgid, thread t, synindex syn_id, size_t n)
+{
+  ConnectorBase* conn = get_connector(t, sgid);
+  return conn != 0 && conn->reserve(syn_id, n);
+}
+
+void ConnectionManager::finalize_connections()
+{
+#pragma omp parallel
+  {
+    const thread t = net_.get_thread_id();
+    for (tSConnector::nonempty_iterator it = connections_[t].nonempty_begin(); it != connections_[t].nonempty_end(); ++it)
+      (*it)->shrink_to_fit();
+  }
 }
 
 void ConnectionManager::set_prototype_status(synindex syn_id, const DictionaryDatum& d)
@@ -528,6 +557,8 @@ void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index
   ConnectorBase* conn = validate_source_entry(tid, s_gid, syn);
   ConnectorBase* c = prototypes_[tid][syn]->add_connection(s, r, conn, syn, d, w);
   connections_[tid].set(s_gid, c);
+  r.set_has_incoming_connections_();
+  connectivity_changed_ = true;
 }
 
 void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index syn, DictionaryDatum& p, double_t d, double_t w)
@@ -536,6 +567,8 @@ void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index
   ConnectorBase* conn = validate_source_entry(tid, s_gid, syn);
   ConnectorBase* c = prototypes_[tid][syn]->add_connection(s, r, conn, syn, p, d, w);
   connections_[tid].set(s_gid, c);
+  r.set_has_incoming_connections_();
+  connectivity_changed_ = true;
 }
 
 /**
@@ -611,6 +644,29 @@ void ConnectionManager::send(thread t, index sgid, Event& e)
       connections_[t].get(sgid)->send(e, t, prototypes_[t]);
 }
 
+void ConnectionManager::send(thread t, ConnectorBase* c, Event& e)
+{
+  c->send(e, t, prototypes_[t]);
+}
+
+void ConnectionManager::get_sources_with_local_targets(std::vector<index>& sources) const
+{
+  index max_size = 0;
+  for (thread t = 0; t < net_.get_num_threads(); ++t)
+    max_size = std::max(max_size, static_cast<index>(connections_[t].size()));
+
+  std::vector<bool> has_targets(max_size, false);
+  for (thread t = 0; t < net_.get_num_threads(); ++t)
+    for (index source_id = 1; source_id < connections_[t].size(); ++source_id)
+      if (connections_[t].test(source_id))
+        has_targets[source_id] = true;
+
+  sources.clear();
+  for (index source_id = 1; source_id < max_size; ++source_id)
+    if (has_targets[source_id])
+      sources.push_back(source_id);
+}
+
 size_t ConnectionManager::get_num_connections() const
 {
   num_connections_ = 0;
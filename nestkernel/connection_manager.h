@@ -142,6 +142,50 @@ public:
 
   void send(thread t, index sgid, Event& e);
 
+  /**
+   * Reserve memory for n further connections of type syn_id from node
+   * sgid on thread t. Returns false if there is no connector yet or it
+   * cannot reserve memory in its current form.
+   */
+  bool reserve_connections(index sgid, thread t, synindex syn_id, size_t n);
+
+  /**
+   * Release memory reserved by connectors for connections not yet
+   * created. Called before simulating if connections were created.
+   */
+  void finalize_connections();
+
+  /**
+   * Send event e to all targets in connector c on thread t. Together
+   * with get_connector(), this allows to send several events from the
+   * same source with a single lookup.
+   */
+  void send(thread t, ConnectorBase* c, Event& e);
+
+  /**
+   * Return the connector holding the targets of node sgid on thread t,
+   * or 0 if there are none.
+   */
+  ConnectorBase* get_connector(thread t, index sgid) const;
+
+  /**
+   * Collect the GIDs of all sources with targets on any local thread.
+   * The result is sorted and contains each GID only once.
+   */
+  void get_sources_with_local_targets(std::vector<index>& sources) const;
+
+  /**
+   * Return true if the node with GID sgid has targets on thread t.
+   */
+  bool has_targets(thread t, index sgid) const;
+
+  /**
+   * Return true if connections were created since the last call
+   * to reset_connectivity_changed().
+   */
+  bool get_connectivity_changed() const;
+  void reset_connectivity_changed();
+
   /**
    * Resize the structures for the Connector objects if necessary.
    * This function should be called after number of threads, min_delay, max_delay, 
@@ -172,6 +216,8 @@ private:
   
   mutable size_t num_connections_;              //!< The global counter for the number of synapses
 
+  bool connectivity_changed_;   //!< Set whenever a connection is created
+
   void init_();
   void delete_connections_();
   void clear_prototypes_();
@@ -206,6 +252,30 @@ inline
     throw UnknownSynapseType(syn_id);
 }
 
+inline
+bool ConnectionManager::has_targets(thread t, index sgid) const
+{
+  return sgid < connections_[t].size() && connections_[t].test(sgid);
+}
+
+inline
+ConnectorBase* ConnectionManager::get_connector(thread t, index sgid) const
+{
+  return sgid < connections_[t].size() ? connections_[t].get(sgid) : 0;
+}
+
+inline
+bool ConnectionManager::get_connectivity_changed() const
+{
+  return connectivity_changed_;
+}
+
+inline
+void ConnectionManager::reset_connectivity_changed()
+{
+  connectivity_changed_ = false;
+}
+
 inline
 bool ConnectionManager::has_user_prototypes() const
 {
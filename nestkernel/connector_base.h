@@ -113,6 +113,16 @@ namespace nest
     // returns true, if all synapse models are of same type
     virtual bool homogeneous_model() = 0;
 
+    // reserve memory for n further connections of type syn_id
+    // returns false if the connector cannot grow in place
+    virtual bool reserve(synindex syn_id, size_t n) = 0;
+
+    // release memory reserved for connections not yet created
+    virtual void shrink_to_fit() = 0;
+
+    // add the number of bytes used by connections of each synapse type to mem[syn_id]
+    virtual void get_memory(std::vector<size_t> & mem) const = 0;
+
     // destructor needed to delete connections
     virtual ~ConnectorBase() { };
 
@@ -236,6 +246,15 @@ namespace nest
 
     bool homogeneous_model() { return true; }
 
+    bool reserve(synindex, size_t) { return false; }
+
+    void shrink_to_fit() {}
+
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      mem[get_syn_id()] += sizeof(*this);
+    }
+
   };
 
   // homogeneous connector containing 1 entry (specialization to define constructor)
@@ -331,12 +350,23 @@ namespace nest
 
     bool homogeneous_model() { return true; }
 
+    bool reserve(synindex, size_t) { return false; }
+
+    void shrink_to_fit() {}
+
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      mem[get_syn_id()] += sizeof(*this);
+    }
+
   };
 
 
   // homogeneous connector containing >=K_cutoff entries
   // specialization to define recursion termination for push_back
-  // internally use a normal vector to store elements
+  // internally use a normal vector to store elements, which doubles its
+  // capacity when full, so that shrink_to_fit() should be called once
+  // all connections are created
   template < typename ConnectionT >
   class Connector<K_cutoff, ConnectionT> : public vector_like<ConnectionT>
   {
@@ -435,6 +465,25 @@ namespace nest
 
     bool homogeneous_model() { return true; }
 
+    bool reserve(synindex syn_id, size_t n)
+    {
+      if (syn_id != get_syn_id())
+	return false;
+      C_.reserve(C_.size() + n);
+      return true;
+    }
+
+    void shrink_to_fit()
+    {
+      if (C_.capacity() > C_.size())
+	std::vector<ConnectionT>(C_).swap(C_);
+    }
+
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      mem[get_syn_id()] += sizeof(*this) + C_.capacity() * sizeof(ConnectionT);
+    }
+
   };
 
   // heterogeneous connector containing different types of synapses
@@ -518,6 +567,27 @@ namespace nest
     // returns true, if all synapse models are of same type
     bool homogeneous_model() { return false; }
 
+    bool reserve(synindex syn_id, size_t n)
+    {
+      for (size_t i=0; i<size(); i++)
+	if (syn_id == at(i)->get_syn_id())
+	  return at(i)->reserve(syn_id, n);
+      return false;
+    }
+
+    void shrink_to_fit()
+    {
+      for (size_t i=0; i<size(); i++)
+	at(i)->shrink_to_fit();
+    }
+
+    // the memory of the HetConnector itself is not attributed to any synapse type
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      for (size_t i=0; i<size(); i++)
+	at(i)->get_memory(mem);
+    }
+
   };
 
 } // of namespace nest
@@ -32,7 +32,9 @@
 
   // member functions of histentry
 
-  nest::histentry::histentry(double_t t, double_t Kminus, double_t triplet_Kminus, size_t access_counter) :
-    t_(t), Kminus_(Kminus), triplet_Kminus_(triplet_Kminus), access_counter_(access_counter)
+  nest::histentry::histentry(double_t t, double_t Kminus, double_t triplet_Kminus, size_t access_counter,
+                             double_t dt) :
+    t_(t), Kminus_(Kminus), triplet_Kminus_(triplet_Kminus), access_counter_(access_counter),
+    dt_(dt), decay_(-1.0)
   { } 
 
@@ -33,6 +33,7 @@
 #define HISTENTRY_H
 
 #include "nest.h"
+#include <cmath>
 
 namespace nest {
 
@@ -40,13 +41,18 @@ namespace nest {
   class histentry
   {
     public:
-      histentry(double_t t, double_t Kminus, double_t triplet_Kminus, size_t access_counter);
+      histentry(double_t t, double_t Kminus, double_t triplet_Kminus, size_t access_counter,
+                double_t dt = 0.0);
 
       double_t t_;              // point in time when spike occurred (in ms)
       double_t Kminus_;         // value of Kminus at that time
       double_t triplet_Kminus_; // value of triplet STDP Kminus at that time
       size_t access_counter_;   // how often this entry was accessed (to enable removal,
                                 // once read by all neurons which need it)
+      double_t dt_;             // time since previous entry (in ms)
+      double_t decay_;          // exp(-dt_/tau) for the time constant given to
+                                // Archiving_Node::get_history(), negative if not
+                                // computed yet
   };
 
 }
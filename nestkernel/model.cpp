@@ -33,7 +33,8 @@ namespace nest
   Model::Model(const std::string& name)
     : name_(name),
       type_id_(0),
-      memory_()
+      memory_(),
+      buffers_()
   {}
   
   void Model::set_threads()
@@ -50,6 +51,9 @@ namespace nest
     std::vector<sli::pool> tmp(t); 
     memory_.swap(tmp);
 
+    std::vector<sli::arena> tmp_buffers(t);
+    buffers_.swap(tmp_buffers);
+
     for (size_t i = 0; i < memory_.size(); ++i)
       init_memory_(memory_[i]);
   }
@@ -85,6 +89,24 @@ namespace nest
     return result;
   }
 
+  size_t Model::buffer_capacity()
+  {
+    size_t result = 0;
+    for (size_t t = 0; t < buffers_.size(); ++t)
+      result += buffers_[t].get_total();
+
+    return result;
+  }
+
+  size_t Model::buffer_used()
+  {
+    size_t result = 0;
+    for (size_t t = 0; t < buffers_.size(); ++t)
+      result += buffers_[t].get_used();
+
+    return result;
+  }
+
   void Model::set_status(DictionaryDatum d)
   {
     try 
@@ -118,6 +140,16 @@ namespace nest
 
     (*d)["available"]= Token(tmp);
 
+    for(size_t t=0; t< tmp.size(); ++t)
+      tmp[t]= buffers_[t].get_total();
+
+    (*d)["buffer_capacity"]= Token(tmp);
+
+    for(size_t t=0; t< tmp.size(); ++t)
+      tmp[t]= buffers_[t].get_used();
+
+    (*d)["buffer_used"]= Token(tmp);
+
     (*d)["model"]=LiteralDatum(get_name());
     return d;
   }
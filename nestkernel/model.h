@@ -39,7 +39,8 @@ namespace nest
    * class. The Model class is responsible for the creation and class
    * wide parametrisation of its associated Node objects.
    *
-   * class Model manages the thread-sorted memory pool of the model.
+   * class Model manages the thread-sorted memory pool of the model and
+   * a thread-sorted arena for the input buffers of its nodes.
    * The default constructor uses one thread as default. Use set_threads() to
    * use more than one thread.
    * @ingroup user_interface
@@ -53,7 +54,8 @@ namespace nest
       Model(const Model& m):
       name_(m.name_),
       type_id_(m.type_id_),
-      memory_(m.memory_)
+      memory_(m.memory_),
+      buffers_(m.buffers_)
 	  {}
     
       virtual ~Model(){}
@@ -98,6 +100,15 @@ namespace nest
      */
     void  reserve_additional(thread t, size_t n);
 
+    /**
+     * Return the buffer arena for thread t.
+     * Nodes allocate their input buffers from this arena in
+     * init_buffers(), so that the buffers of all nodes of a model on a
+     * thread lie next to each other in the order of creation. Memory
+     * is only returned when the model is cleared.
+     */
+    sli::arena& get_buffer_arena(thread t);
+
     /**
      * Return name of the Model.
      * This function returns the name of the Model as C++ string. The
@@ -122,6 +133,18 @@ namespace nest
      */
     size_t mem_capacity();
 
+    /**
+     * Return the size of the buffer arenas in bytes.
+     * Note that this function reports a sum over all threads.
+     */
+    size_t buffer_capacity();
+
+    /**
+     * Return the number of bytes used in the buffer arenas.
+     * Note that this function reports a sum over all threads.
+     */
+    size_t buffer_used();
+
     virtual bool has_proxies()=0;
     virtual bool potential_global_receiver()=0;
     virtual bool one_node_per_process()=0;
@@ -223,6 +246,11 @@ namespace nest
      */
     std::vector<sli::pool> memory_;
 
+    /**
+     * Memory for the input buffers of all nodes sorted by threads.
+     */
+    std::vector<sli::arena> buffers_;
+
   };
 
 
@@ -233,6 +261,13 @@ namespace nest
     return allocate_(memory_[t].alloc());
   }
 
+  inline
+  sli::arena& Model::get_buffer_arena(thread t)
+  {
+    assert((size_t)t < buffers_.size());
+    return buffers_[t];
+  }
+
   inline
   void Model::free(thread t, Node *n)
   {
@@ -44,6 +44,7 @@ namespace nest
     const Name autapses("autapses");
 
     const Name b("b");
+    const Name batched("batched");
     const Name beta("beta");
     const Name binary("binary");
 
@@ -61,6 +62,7 @@ namespace nest
     const Name coeff_ex("coeff_ex");
     const Name coeff_in("coeff_in");
     const Name coeff_m("coeff_m");
+    const Name columnar("columnar");
     const Name connection_count("connection_count");
     const Name consistent_integration("consistent_integration");
     const Name count_covariance("count_covariance");
@@ -181,6 +183,7 @@ namespace nest
     const Name MAXERR("MAXERR");
     const Name mean("mean");
     const Name memory("memory");
+    const Name memory_mapped("memory_mapped");
     const Name model("model");
     const Name mother_rng("mother_rng");
     const Name mother_seed("mother_seed");
@@ -192,6 +195,7 @@ namespace nest
     const Name N_channels("N_channels");
     const Name n_events("n_events");
     const Name n_proc("n_proc");
+    const Name native_integrator("native_integrator");
     const Name neuron("neuron");
     const Name noise("noise");
     const Name ns("ns");
@@ -216,6 +220,7 @@ namespace nest
     const Name potentials("potentials");
     const Name precise_times("precise_times");
     const Name precision("precision");
+    const Name propagator_sets("propagator_sets");
     const Name ps("ps");
     const Name PSC_adapt_step("PSC_adapt_step");
     const Name PSC_Unit_amplitude("PSC_Unit_amplitude");
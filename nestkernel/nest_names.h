@@ -56,6 +56,7 @@ namespace nest
     extern const Name autapses;                 //!< Connectivity-related
 
     extern const Name b;                        //!< Specific to Brette & Gerstner 2005 (aeif_cond-*)
+    extern const Name batched;                  //!< Specific to poisson_generator
     extern const Name beta;                     //!< Specific to amat2_*
     extern const Name binary;                   //!< Recorder parameter
 
@@ -73,6 +74,7 @@ namespace nest
     extern const Name coeff_ex;                 //!< tau_lcm=coeff_ex*tau_ex (precise timing neurons (Brette 2007))
     extern const Name coeff_in;                 //!< tau_lcm=coeff_in*tau_in (precise timing neurons (Brette 2007))
     extern const Name coeff_m;                  //!< tau_lcm=coeff_m*tau_m (precise timing neurons (Brette 2007))
+    extern const Name columnar;                 //!< Recorder parameter
     extern const Name connection_count;         //!< Parameters for MUSIC devices
     extern const Name consistent_integration;   //!< Specific to Izhikevich 2003
     extern const Name count_covariance;         //!< Specific to correlomatrix_detector
@@ -193,6 +195,7 @@ namespace nest
     extern const Name MAXERR;                   //!< Largest permissible error for adaptive stepsize (Brette & Gerstner 2005)
     extern const Name mean;                     //!< Miscellaneous parameters
     extern const Name memory;                   //!< Recorder parameter
+    extern const Name memory_mapped;            //!< Recorder parameter
     extern const Name model;                    //!< Node parameter
     extern const Name mother_rng;               //!< Specific to mip_generator
     extern const Name mother_seed;              //!< Specific to mip_generator
@@ -204,6 +207,7 @@ namespace nest
     extern const Name N_channels;               //!< Specific to correlomatrix_detector
     extern const Name n_events;                 //!< Recorder parameter
     extern const Name n_proc;                   //!< Number of component processes of ppd_sup_/gamma_sup_generator
+    extern const Name native_integrator;        //!< Use the native batched ODE solver instead of GSL (iaf_cond_exp/alpha, aeif_cond_exp/alpha, hh_psc_alpha, hh_cond_exp_traub, ht_neuron)
     extern const Name neuron;                   //!< Node type
     extern const Name noise;                    //!< Specific to iaf_chs_2008 neuron
     extern const Name ns;                       //!< Number of release sites (property arrays)
@@ -228,6 +232,7 @@ namespace nest
     extern const Name potentials;               //!< Recorder parameter
     extern const Name precise_times;            //!< Recorder parameter
     extern const Name precision;                //!< Recorder parameter
+    extern const Name propagator_sets;          //!< Number of propagator sets shared by neurons of a model
     extern const Name ps;                       //!< current release probability [0...1] (property arrays)
     extern const Name PSC_adapt_step;           //!< PSC increment (current homeostasis)
     extern const Name PSC_Unit_amplitude;       //!< Scaling of PSC (current homeostasis)
@@ -1231,6 +1231,8 @@ namespace nest
      MemoryInfo reports the current utilization of the memory manager for all models,
      which are used at least once. The output is sorted ascending according according
      to the name of the model is written to stdout. The unit of the data is byte.
+     Capacity and Available refer to the memory holding the nodes, Buffers and
+     Buffers used to the arenas holding the input buffers of the nodes.
      Note that MemoryInfo only gives you information about the memory requirements of
      the static model data inside of NEST. It does not tell anything about the memory
      situation on your computer. 
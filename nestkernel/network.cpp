@@ -669,12 +669,14 @@ void Network::memory_info()
 
   std::sort(idx.begin(), idx.end(), ModelComp(models_));
 
-  std::string sep("--------------------------------------------------");
+  std::string sep("------------------------------------------------------------------------------");
 
   std::cout << sep << std::endl;
   std::cout << std::setw(25) << "Name"
       << std::setw(13) << "Capacity"
       << std::setw(13) << "Available"
+      << std::setw(13) << "Buffers"
+      << std::setw(13) << "Buffers used"
       << std::endl;
   std::cout << sep << std::endl;
 
@@ -685,6 +687,8 @@ void Network::memory_info()
       std::cout << std::setw(25) << mod->get_name()
       << std::setw(13) << mod->mem_capacity() * mod->get_element_size()
       << std::setw(13) << mod->mem_available() * mod->get_element_size()
+      << std::setw(13) << mod->buffer_capacity()
+      << std::setw(13) << mod->buffer_used()
       << std::endl;
   }
 
@@ -850,15 +854,6 @@ DictionaryDatum Network::get_status(index idx)
     (*d)["data_prefix"] = data_prefix_;
     (*d)["overwrite_files"] = overwrite_files_;
     (*d)["dict_miss_is_error"] = dict_miss_is_error_;
-
-    std::map<long, size_t> sna_cts = local_nodes_.get_step_ctr();
-    DictionaryDatum cdict(new Dictionary);
-    for ( std::map<long, size_t>::const_iterator cit = sna_cts.begin(); cit != sna_cts.end(); ++cit )
-    {
-      std::stringstream s;
-      s << cit->first;
-      (*cdict)[s.str()] = cit->second;
-    }
   }
   return d;
 }
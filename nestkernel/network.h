@@ -105,8 +105,14 @@ Parameters:
   The following parameters can be set in the status dictionary.
 
   communicate_allgather    booltype    - Whether to use MPI_Allgather for communication (otherwise use CPEX)
+  communicate_alltoallv    booltype    - Whether to send spikes only to processes with targets, via MPI_Alltoallv
+  communication_time_hidden doubletype - Time (in ms) the spike exchange ran concurrently with node updates (read only)
+  communication_time_waited doubletype - Time (in ms) spent waiting for the spike exchange to complete (read only)
+  connector_lookups        integertype - The number of connector lookups for received spikes (read only)
+  connector_memory         dictionarytype - Memory (in bytes) used by connectors of each synapse type (read only)
   data_path                stringtype  - A path, where all data is written to (default is the current directory)
   data_prefix              stringtype  - A common prefix for all data files
+  delivery_time            doubletype  - Time (in ms) spent delivering received spikes, maximum over threads (read only)
   dict_miss_is_error       booltype    - Whether missed dictionary entries are treated as errors
   local_num_threads        integertype - The local number of threads (cf. global_num_virt_procs)
   max_delay                doubletype  - The maximum delay in the network
@@ -119,9 +125,12 @@ Parameters:
   num_sim_processes        integertype - The number of MPI processes reserved for simulating neurons
   off_grid_spiking         booltype    - Whether to transmit precise spike times in MPI communicatio
   overwrite_files          booltype    - Whether to overwrite existing data files
+  pipelined_communication  booltype    - Whether to update nodes without incoming connections during spike exchange
+  population_update        booltype    - Whether to update consecutive neurons of models that support it (iaf_psc_exp, iaf_psc_alpha, iaf_psc_delta, and iaf_cond_exp, iaf_cond_alpha, aeif_cond_exp, aeif_cond_alpha, hh_psc_alpha, hh_cond_exp_traub and ht_neuron with native_integrator) together, with their state in arrays
   print_time               booltype    - Whether to print progress information during the simulation
   resolution               doubletype  - The resolution of the simulation (in ms)
   rng_buffsize             integertype - The buffer size of the random number generators
+  sort_spikes_by_source    booltype    - Whether to deliver received spikes in order of their sender GID
   tics_per_ms              doubletype  - The number of tics per milisecond (cf. ms_per_tic, tics_per_step)
   tics_per_step            integertype - The number of tics per simulation time step (cf. ms_per_tic, tics_per_ms)
   time                     doubletype  - The current simulation time
@@ -129,6 +138,7 @@ Parameters:
   to_do                    integertype - The number of steps yet to be simulated
   T_max                    doubletype  - The largest representable time value
   T_min                    doubletype  - The smallest representable time value
+  vp_independent_rng       booltype    - Whether connection routines draw from counter-based random streams per target or source, giving the same network for any number of virtual processes. This covers the one_to_one, all_to_all, pairwise_bernoulli, fixed_indegree and fixed_outdegree rules and topology connections, but not fixed_total_number. Stimulus devices always draw from the thread RNGs.
 SeeAlso: Simulate, Node
 */
   
@@ -375,6 +385,13 @@ SeeAlso: Simulate, Node
     void connect(const GIDCollection&, const GIDCollection&,
 		     const DictionaryDatum&, const DictionaryDatum&);
 
+    /**
+     * Reserve memory for n further connections of synapse type syn
+     * from node s on thread t. Returns false if the connector of s
+     * cannot reserve memory in its current form.
+     */
+    bool reserve_connections(index s, thread t, index syn, size_t n);
+
     DictionaryDatum get_connector_defaults(index sc);
     void set_connector_defaults(index sc, DictionaryDatum& d);
 
@@ -491,6 +508,19 @@ SeeAlso: Simulate, Node
      */
     librandom::RngPtr get_grng() const;
 
+    /**
+     * Get random number client of a thread for drawing numbers that
+     * concern the given source and target.
+     * @see Scheduler::get_stream_rng
+     */
+    librandom::RngPtr get_stream_rng(thread, index, index, ulong_t) const;
+
+    /**
+     * Get a new purpose for get_stream_rng().
+     * @see Scheduler::new_rng_purpose
+     */
+    ulong_t new_rng_purpose();
+
     /**
      * Get number of threads.
      * This function returns the total number of threads per process.
@@ -932,6 +962,12 @@ SeeAlso: Simulate, Node
     connection_manager_.set_prototype_status(sc, d);
   }
 
+  inline
+  bool Network::reserve_connections(index s, thread t, index syn, size_t n)
+  {
+    return connection_manager_.reserve_connections(s, t, syn, n);
+  }
+
   inline
   DictionaryDatum Network::get_connector_defaults(index sc)
   {
@@ -1165,6 +1201,18 @@ SeeAlso: Simulate, Node
     return scheduler_.get_grng();
   }
 
+  inline
+  librandom::RngPtr Network::get_stream_rng(thread t, index source, index target, ulong_t purpose) const
+  {
+    return scheduler_.get_stream_rng(t, source, target, purpose);
+  }
+
+  inline
+  ulong_t Network::new_rng_purpose()
+  {
+    return scheduler_.new_rng_purpose();
+  }
+
   inline
   Model* Network::get_model(index m) const
   {
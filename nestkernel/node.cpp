@@ -43,7 +43,8 @@ namespace nest {
        thread_(0),
        vp_(invalid_thread_),
        frozen_(false),
-       buffers_initialized_(false)
+       buffers_initialized_(false),
+       has_incoming_connections_(false)
   {
   }
 
@@ -56,7 +57,8 @@ namespace nest {
        thread_(n.thread_),
        vp_(n.vp_),
        frozen_(n.frozen_),
-       buffers_initialized_(false)  // copy must always initialized its own buffers
+       buffers_initialized_(false),  // copy must always initialized its own buffers
+       has_incoming_connections_(false)
   {
   }
 
@@ -96,6 +98,11 @@ namespace nest {
     return *net_->get_model(model_id_);
   }      
 
+  sli::arena & Node::get_buffer_arena_() const
+  {
+    return get_model_().get_buffer_arena(get_thread());
+  }
+
   bool Node::is_local() const
   {
     return !is_proxy();
@@ -200,6 +207,18 @@ namespace nest {
     throw UnexpectedEvent();
   }
 
+  void Node::handle_batch(SpikeEvent& e, const long_t* lags, const long* counts, size_t n)
+  {
+    const Time& origin = network()->get_slice_origin();
+    for ( size_t i = 0 ; i < n ; ++i )
+      if ( counts[i] > 0 ) // we must not send events with multiplicity 0
+      {
+        e.set_stamp(origin + Time::step(lags[i] + 1));
+        e.set_multiplicity(counts[i]);
+        handle(e);
+      }
+  }
+
   port Node::handles_test_event(SpikeEvent&, rport)
   {
     throw IllegalConnection();
@@ -282,8 +301,16 @@ namespace nest {
   }
 
   void nest::Node::get_history(double_t, double_t,
-			       std::deque<histentry>::iterator*,
-			       std::deque<histentry>::iterator*)
+			       histentry**,
+			       histentry**)
+  {
+    throw UnexpectedEvent();
+  }
+
+  bool nest::Node::get_history(double_t, double_t,
+			       histentry**,
+			       histentry**,
+			       double_t)
   {
     throw UnexpectedEvent();
   }
@@ -298,6 +325,18 @@ namespace nest {
     throw UnexpectedEvent();
   }
 
+  bool Node::has_population_update() const
+  {
+    return false;
+  }
+
+  void Node::update_population(Node* const* nodes, size_t n,
+                               Time const & origin, const long_t from, const long_t to)
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+      nodes[i]->update(origin, from, to);
+  }
+
   void Node::event_hook(DSSpikeEvent& e)
   {
     e.get_receiver().handle(e);
@@ -39,6 +39,10 @@
  * Declarations for base class Node
  */
 
+namespace sli {
+  class arena;
+}
+
 namespace nest {
 
   class Scheduler;
@@ -97,6 +101,7 @@ namespace nest {
   {
     friend class Network;
     friend class Scheduler;
+    friend class ConnectionManager;
     friend class Subnet;
     friend class proxynode;
     friend class Synapse;
@@ -229,6 +234,11 @@ namespace nest {
      */
     bool is_frozen() const;
 
+    /**
+     * Returns true if the node is the target of at least one connection.
+     */
+    bool has_incoming_connections() const;
+
     /**
      * Return pointer to network driver class.
      * @todo This member should return a reference, not a pointer.
@@ -300,6 +310,30 @@ namespace nest {
     virtual 
     void update(Time const &, const long_t, const long_t)=0;
 
+    /**
+     * Return true if update_population() can update several nodes of
+     * this model at once.
+     * @see update_population()
+     */
+    virtual
+    bool has_population_update() const;
+
+    /**
+     * Bring nodes[0], ..., nodes[n-1] from state $t$ to $t+n*dt$.
+     *
+     * The nodes must be of the same model as this node. The result is
+     * the same as calling update() for each node. Models overriding
+     * has_population_update() gather the state of all nodes into
+     * arrays and advance them in one loop per step. The kernel uses
+     * this instead of update() if /population_update is set. The
+     * default implementation calls update() for each node.
+     *
+     * @see update()
+     */
+    virtual
+    void update_population(Node* const* nodes, size_t n,
+                           Time const &, const long_t, const long_t);
+
 
     /**
      * @defgroup status_interface Configuration interface.
@@ -421,6 +455,25 @@ namespace nest {
     virtual
     void handle(SpikeEvent& e);
 
+    /**
+     * Handle the spikes of several steps of the current slice at once.
+     * @param e Event object, giving weight, delay and receptor.
+     * @param lags Ascending lags at which the spikes were emitted.
+     * @param counts Number of spikes emitted at each lag.
+     * @param n Number of lags.
+     *
+     * Devices that draw the spikes of a whole slice at once, such as
+     * poisson_generator with /batched true, call this instead of
+     * handle(SpikeEvent&) once per lag. The default implementation
+     * stamps the event for each lag with a non-zero count and calls
+     * handle(SpikeEvent&). Neurons may override it to write all spikes
+     * to their input buffers in one go.
+     * @see handle(SpikeEvent&)
+     * @ingroup event_interface
+     */
+    virtual
+    void handle_batch(SpikeEvent& e, const long_t* lags, const long* counts, size_t n);
+
     /**
      * Handler for rate events.
      * @see handle(SpikeEvent&)
@@ -498,8 +551,19 @@ namespace nest {
      */
      virtual
      void get_history(double_t t1, double_t t2, 
-                   std::deque<histentry>::iterator* start,
-  		   std::deque<histentry>::iterator* finish);
+                   histentry** start,
+  		   histentry** finish);
+
+    /**
+     * return the spike history for (t1,t2]; if true is returned, decay_
+     * of each entry is set to exp(-dt_/tau).
+     * @throws UnexpectedEvent
+     */
+     virtual
+     bool get_history(double_t t1, double_t t2, 
+                   histentry** start,
+  		   histentry** finish,
+                   double_t tau);
 
     /**
      * Modify Event object parameters during event delivery.
@@ -663,9 +727,20 @@ namespace nest {
 
     Model & get_model_() const;
 
+    /**
+     * Return the buffer arena of the model of the node for the thread
+     * of the node. Input buffers allocated from it in init_buffers_()
+     * lie next to those of the nodes created before.
+     * @see Model::get_buffer_arena()
+     */
+    sli::arena & get_buffer_arena_() const;
+
     //! Mark node as frozen.
     void set_frozen_(bool frozen) { frozen_ = frozen; }
 
+    //! Mark node as target of a connection.
+    void set_has_incoming_connections_() { has_incoming_connections_ = true; }
+
     /**
      * Auxiliary function to downcast a Node to a concrete class derived from Node.
      * @note This function is used to convert generic Node references to specific
@@ -696,6 +771,7 @@ namespace nest {
     thread   vp_;            //!< virtual process node is assigned to
     bool     frozen_;   //!< node shall not be updated if true
     bool     buffers_initialized_;   //!< Buffers have been initialized
+    bool     has_incoming_connections_; //!< Node is target of a connection
 
   protected:
     static Network* net_;    //!< Pointer to global network driver.
@@ -707,6 +783,12 @@ namespace nest {
     return frozen_;
   }
 
+  inline
+  bool Node::has_incoming_connections() const
+  {
+    return has_incoming_connections_;
+  }
+
   inline
   bool Node::has_proxies() const
   {
@@ -0,0 +1,69 @@
+/*
+ *  population_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_BUFFER_H
+#define POPULATION_BUFFER_H
+
+#include <cstddef>
+
+namespace nest
+{
+
+  /**
+   * Work space for Node::update_population().
+   *
+   * Models implementing update_population() gather the state of the
+   * nodes into arrays. To avoid allocating these arrays in each call,
+   * each model keeps one static PopulationBuffer per element type,
+   * declared threadprivate, and obtains its arrays with get(). The
+   * buffer grows to the largest population updated by the thread and
+   * is kept until the program ends.
+   *
+   * PopulationBuffer is plain data, so that it can be threadprivate,
+   * cf. PoorMansAllocator. As a static, it is initially empty.
+   */
+  template <typename T>
+  struct PopulationBuffer
+  {
+    T* data_;       //!< allocated elements
+    size_t size_;   //!< number of elements in data_
+
+    /**
+     * Return pointer to n_arrays consecutive arrays of n elements,
+     * the k-th array starting at element k*n. The contents are
+     * undefined and are invalidated by the next call.
+     */
+    T* get(size_t n_arrays, size_t n)
+    {
+      if ( n_arrays * n > size_ )
+      {
+        delete [] data_;
+        size_ = n_arrays * n;
+        data_ = new T[size_];
+      }
+      return data_;
+    }
+  };
+
+}
+
+#endif
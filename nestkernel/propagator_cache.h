@@ -0,0 +1,170 @@
+/*
+ *  propagator_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PROPAGATOR_CACHE_H
+#define PROPAGATOR_CACHE_H
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+#include "nest.h"
+
+namespace nest
+{
+
+  /**
+   * Table of propagators shared by neurons with identical parameters.
+   *
+   * Models using exact integration compute propagators from the
+   * resolution and a few parameters in calibrate(). Instead of storing
+   * them in each neuron, they obtain a pointer to the propagators for
+   * their parameters from the cache of their model with update(). The
+   * propagators for a key are computed once and kept as long as a neuron
+   * refers to them; neurons release them with release() when they are
+   * destroyed.
+   *
+   * calibrate() is called in parallel for the nodes of all threads,
+   * therefore changes to the table are protected by a critical section.
+   * A neuron whose key has not changed since its last calibration keeps
+   * its propagators without entering the critical section.
+   */
+  template <typename PropagatorsT, size_t key_size>
+  class PropagatorCache
+  {
+  public:
+
+    //! Resolution and parameters the propagators depend on
+    struct Key {
+      double_t values[key_size];
+
+      double_t& operator[](size_t i) { return values[i]; }
+      double_t operator[](size_t i) const { return values[i]; }
+
+      bool operator<(const Key& k) const
+      {
+        return std::lexicographical_compare(values, values + key_size, k.values, k.values + key_size);
+      }
+
+      bool operator==(const Key& k) const
+      {
+        return std::equal(values, values + key_size, k.values);
+      }
+    };
+
+    //! Function computing the propagators for a key
+    typedef void (*Compute)(const Key&, PropagatorsT&);
+
+    PropagatorCache(Compute compute)
+      : compute_(compute)
+    {}
+
+    /**
+     * Return the propagators for key, replacing the propagators current
+     * obtained earlier, which may be a null pointer. If current belongs
+     * to key, it is returned without locking. Otherwise the reference to
+     * current is dropped and one to the propagators for key counted,
+     * which are computed if there are none for key yet.
+     */
+    const PropagatorsT* update(const PropagatorsT* current, const Key& key);
+
+    //! Drop a reference obtained from update(), a null pointer is ignored.
+    void release(const PropagatorsT* propagators);
+
+    //! Return the number of different propagator sets in use
+    size_t size() const { return table_.size(); }
+
+  private:
+
+    /**
+     * Entries are never changed once computed, so that the key of the
+     * propagators held by a neuron can be read without locking.
+     */
+    struct Entry_ : public PropagatorsT {
+      Key key;
+      size_t references;
+    };
+
+    typedef std::map<Key, Entry_> Table_;
+
+    //! Drop a reference, must be called in the critical section
+    void release_(const PropagatorsT* propagators);
+
+    Compute compute_;
+    Table_ table_;     //!< propagators by key
+  };
+
+  template <typename PropagatorsT, size_t key_size>
+  const PropagatorsT* PropagatorCache<PropagatorsT, key_size>::update(const PropagatorsT* current,
+                                                                      const Key& key)
+  {
+    if ( current != 0 && static_cast<const Entry_*>(current)->key == key )
+      return current;
+
+    const PropagatorsT* propagators;
+
+#pragma omp critical (propagator_cache)
+    {
+      typename Table_::iterator it = table_.find(key);
+      if ( it == table_.end() )
+      {
+        it = table_.insert(std::make_pair(key, Entry_())).first;
+        compute_(key, it->second);
+        it->second.key = key;
+        it->second.references = 0;
+      }
+      ++it->second.references;
+      propagators = &it->second;
+
+      release_(current);
+    }
+
+    return propagators;
+  }
+
+  template <typename PropagatorsT, size_t key_size>
+  void PropagatorCache<PropagatorsT, key_size>::release(const PropagatorsT* propagators)
+  {
+    if ( propagators == 0 )
+      return;
+
+#pragma omp critical (propagator_cache)
+    {
+      release_(propagators);
+    }
+  }
+
+  template <typename PropagatorsT, size_t key_size>
+  void PropagatorCache<PropagatorsT, key_size>::release_(const PropagatorsT* propagators)
+  {
+    if ( propagators == 0 )
+      return;
+
+    typename Table_::iterator it = table_.find(static_cast<const Entry_*>(propagators)->key);
+    assert(it != table_.end());
+    if ( --it->second.references == 0 )
+      table_.erase(it);
+  }
+
+}
+
+#endif // PROPAGATOR_CACHE_H
@@ -30,8 +30,13 @@
 #include "sliexceptions.h"
 #include <iostream> // using cerr for error message.
 #include <iomanip>
+#include <cstring>
 #include "fdstream.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 // nestmodule provides global access to the network, so we can
 // issue warning messages. This is messy and needs cleaning up.
 #include "nestmodule.h"
@@ -55,7 +60,9 @@ nest::RecordingDevice::Parameters_::Parameters_(const std::string& file_ext,
     precision_(3),
     scientific_(false),
     binary_(false),
+    columnar_(false),
     fbuffer_size_(BUFSIZ), // default buffer size as defined in <cstdio>
+    memory_mapped_(false),
     label_(),
     file_ext_(file_ext),
     filename_(),
@@ -65,6 +72,14 @@ nest::RecordingDevice::Parameters_::Parameters_(const std::string& file_ext,
     close_on_reset_(true)
 {}
 
+nest::RecordingDevice::BinaryColumns_::BinaryColumns_()
+  : names_(),
+    value_names_(),
+    n_records_(0)
+{}
+
+const size_t nest::RecordingDevice::binary_block_size = 1 << 14;
+
 nest::RecordingDevice::State_::State_()
   : events_(0),
     event_senders_(),
@@ -111,7 +126,10 @@ void nest::RecordingDevice::Parameters_::get(const RecordingDevice& rd,
   (*d)[names::scientific] = scientific_;
 
   (*d)[names::binary] = binary_;
+  (*d)[names::columnar] = columnar_;
   (*d)[names::fbuffer_size] = fbuffer_size_;
+  if ( rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
+    (*d)[names::memory_mapped] = memory_mapped_;
 
   (*d)[names::close_after_simulate] = close_after_simulate_;
   (*d)[names::flush_after_simulate] = flush_after_simulate_;
@@ -141,6 +159,9 @@ void nest::RecordingDevice::Parameters_::set(const RecordingDevice& rd,
   updateValue<bool>(d, names::scientific, scientific_);
 
   updateValue<bool>(d, names::binary, binary_);
+  updateValue<bool>(d, names::columnar, columnar_);
+  if ( rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
+    updateValue<bool>(d, names::memory_mapped, memory_mapped_);
 
   long fbuffer_size;
   if (updateValue<long>(d, names::fbuffer_size, fbuffer_size))
@@ -333,12 +354,8 @@ nest::RecordingDevice::RecordingDevice(const Node& n, Mode mode, const std::stri
    Device::init_buffers();
 
    // we only close files here, opening is left to calibrate()
-   if ( P_.close_on_reset_ && B_.fs_.is_open() )
-   {
-     B_.fs_.close();
-     P_.filename_.clear();  // filename_ only visible while file open
-   }
-
+   if ( P_.close_on_reset_ && file_is_open_() )
+     close_file_();
  }
 
  void nest::RecordingDevice::calibrate()
@@ -350,7 +367,7 @@ nest::RecordingDevice::RecordingDevice(const Node& n, Mode mode, const std::stri
      // do we need to (re-)open the file
      bool newfile = false;
 
-     if ( !B_.fs_.is_open() )
+     if ( !file_is_open_() )
      {
        newfile = true;   // no file from before
        P_.filename_ = build_filename_();
@@ -363,71 +380,35 @@ nest::RecordingDevice::RecordingDevice(const Node& n, Mode mode, const std::stri
          std::string msg = String::compose("Closing file '%1', opening file '%2'", P_.filename_, newname);
          Node::network()->message(SLIInterpreter::M_INFO, "RecordingDevice::calibrate()", msg);
 
-         B_.fs_.close(); // close old file
+         close_file_(); // close old file
          P_.filename_ = newname;
          newfile = true;
        }
      }
 
-     if ( newfile )
+     // columnar files cannot change their columns once written
+     if ( !newfile && P_.columnar_ && !P_.memory_mapped_ )
      {
-       assert(!B_.fs_.is_open());
-
-       if ( Node::network()->overwrite_files() )
-       {
-         if ( P_.binary_ )
-           B_.fs_.open(P_.filename_.c_str(), std::ios::out | std::ios::binary);
-         else
-           B_.fs_.open(P_.filename_.c_str());
-       }
-       else
+       std::vector<std::string> names, dtypes;
+       get_binary_columns_(names, dtypes);
+       if ( names != B_.bc_.names_ )
        {
-         // try opening for reading
-         std::ifstream test(P_.filename_.c_str());
-         if ( test.good() )
-         {
-           std::string msg = String::compose("The device file '%1' exists already and will not be overwritten. "
-                                             "Please change data_path, data_prefix or label, or set /overwrite_files "
-                                             "to true in the root node.",P_.filename_);
-           Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::calibrate()", msg);
-           throw IOError();
-         }
-         else
-           test.close();
-
-         // file does not exist, so we can open
-         if ( P_.binary_ )
-           B_.fs_.open(P_.filename_.c_str(), std::ios::out | std::ios::binary);
-         else
-           B_.fs_.open(P_.filename_.c_str());
-       }
+         std::string msg = String::compose("Columns recorded have changed, reopening file '%1'",
+                                           P_.filename_);
+         Node::network()->message(SLIInterpreter::M_INFO, "RecordingDevice::calibrate()", msg);
 
-       if (P_.fbuffer_size_ != P_.fbuffer_size_old_)
-       {
-         if (P_.fbuffer_size_ == 0)
-           B_.fs_.rdbuf()->pubsetbuf(0, 0);
-         else
-         {
-           std::vector<char>* buffer = new std::vector<char>(P_.fbuffer_size_);
-           B_.fs_.rdbuf()->pubsetbuf(reinterpret_cast<char*>(&buffer[0]), P_.fbuffer_size_);
-         }
-         
-         P_.fbuffer_size_old_ = P_.fbuffer_size_;
+         close_file_();
+         P_.filename_ = build_filename_();
+         newfile = true;
        }
      }
 
-     if ( !B_.fs_.good() )
-     {
-       std::string msg = String::compose("I/O error while opening file '%1'. "
-                                         "This may be caused by too many open files in networks "
-					 "with many recording devices and threads.", P_.filename_);
-       Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::calibrate()", msg);
-                              
-       if ( B_.fs_.is_open() )
-         B_.fs_.close();
-       P_.filename_.clear();
-       throw IOError();
-     }
+     if ( newfile )
+       open_file_();
+
+     // formatting and buffering only apply to streams
+     if ( P_.memory_mapped_ )
+       return;
 
      /* Set formatting
         Formatting is not applied to std::cout for screen output,
@@ -453,16 +434,112 @@ nest::RecordingDevice::RecordingDevice(const Node& n, Mode mode, const std::stri
 
  }
 
+ void nest::RecordingDevice::open_file_()
+ {
+   assert(!file_is_open_());
+
+   if ( !Node::network()->overwrite_files() )
+   {
+     // try opening for reading
+     std::ifstream test(P_.filename_.c_str());
+     if ( test.good() )
+     {
+       std::string msg = String::compose("The device file '%1' exists already and will not be overwritten. "
+                                         "Please change data_path, data_prefix or label, or set /overwrite_files "
+                                         "to true in the root node.",P_.filename_);
+       Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::calibrate()", msg);
+       throw IOError();
+     }
+     else
+       test.close();
+   }
+
+   if ( P_.memory_mapped_ )
+   {
+     if ( !B_.mf_.open(P_.filename_) )
+     {
+       std::string msg = String::compose("I/O error while creating memory-mapped file '%1'.", P_.filename_);
+       Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::calibrate()", msg);
+       P_.filename_.clear();
+       throw IOError();
+     }
+     return;
+   }
+
+   if ( P_.binary_ || P_.columnar_ )
+     B_.fs_.open(P_.filename_.c_str(), std::ios::out | std::ios::binary);
+   else
+     B_.fs_.open(P_.filename_.c_str());
+
+   if (P_.fbuffer_size_ != P_.fbuffer_size_old_)
+   {
+     if (P_.fbuffer_size_ == 0)
+       B_.fs_.rdbuf()->pubsetbuf(0, 0);
+     else
+     {
+       std::vector<char>* buffer = new std::vector<char>(P_.fbuffer_size_);
+       B_.fs_.rdbuf()->pubsetbuf(reinterpret_cast<char*>(&buffer[0]), P_.fbuffer_size_);
+     }
+
+     P_.fbuffer_size_old_ = P_.fbuffer_size_;
+   }
+
+   if ( !B_.fs_.good() )
+   {
+     std::string msg = String::compose("I/O error while opening file '%1'. "
+                                       "This may be caused by too many open files in networks "
+                                       "with many recording devices and threads.", P_.filename_);
+     Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::calibrate()", msg);
+
+     if ( B_.fs_.is_open() )
+       B_.fs_.close();
+     P_.filename_.clear();
+     throw IOError();
+   }
+
+   if ( P_.columnar_ )
+     write_binary_header_();
+ }
+
+ void nest::RecordingDevice::close_file_()
+ {
+   if ( B_.fs_.is_open() )
+   {
+     write_binary_block_();  // records buffered for columnar output, if any
+     B_.fs_.close();
+   }
+   B_.bc_.clear();
+   if ( B_.mf_.is_open() )
+     B_.mf_.close();
+   P_.filename_.clear();  // filename_ only visible while file open
+ }
+
+ bool nest::RecordingDevice::file_is_open_() const
+ {
+   return B_.fs_.is_open() || B_.mf_.is_open();
+ }
+
  void nest::RecordingDevice::finalize()
  {
+   if ( B_.mf_.is_open() )
+   {
+     if ( P_.close_after_simulate_ )
+       close_file_();
+     else if ( P_.flush_after_simulate_ )
+       B_.mf_.sync();
+     return;
+   }
+
    if ( B_.fs_.is_open() )
    {
      if ( P_.close_after_simulate_ )
      {
-       B_.fs_.close();
+       close_file_();
        return;
      }
 
+     write_binary_block_();
+
      if ( P_.flush_after_simulate_ )
        B_.fs_.flush();
 
@@ -482,6 +559,7 @@ nest::RecordingDevice::RecordingDevice(const Node& n, Mode mode, const std::stri
 
 void nest::RecordingDevice::set_status(const DictionaryDatum &d)
 {
+  const bool columnar = P_.columnar_;
   Parameters_ ptmp = P_;    // temporary copy in case of errors
   ptmp.set(*this, B_, d);   // throws if BadProperty
   State_      stmp = S_;
@@ -497,11 +575,10 @@ void nest::RecordingDevice::set_status(const DictionaryDatum &d)
   P_ = ptmp;
   S_ = stmp;
 
-  if ( !P_.to_file_ && B_.fs_.is_open() )
-  {
-    B_.fs_.close();
-    P_.filename_.clear();
-  }
+  // close the file if file output was switched off or changed mode
+  if ( file_is_open_() && ( !P_.to_file_ || P_.memory_mapped_ != B_.mf_.is_open()
+                            || P_.columnar_ != columnar ) )
+    close_file_();
 
   if ( S_.events_ == 0 )
     S_.clear_events();
@@ -510,13 +587,14 @@ void nest::RecordingDevice::set_status(const DictionaryDatum &d)
 
 void nest::RecordingDevice::record_event(const Event& event, bool endrecord)
 {
-  ++S_.events_;
-  const index  sender = event.get_sender_gid();
-  const Time   stamp  = event.get_stamp();
-  const double offset = event.get_offset();
-  const double weight = event.get_weight();
+  record_event(event.get_sender_gid(), event.get_stamp(), event.get_offset(),
+               event.get_weight(), endrecord);
+}
 
-  //std::cout << "recording device sender: " << sender << std::endl;
+void nest::RecordingDevice::record_event(index sender, const Time& stamp,
+                                         double offset, double weight, bool endrecord)
+{
+  ++S_.events_;
 
   if ( P_.to_screen_ )
   {
@@ -527,7 +605,15 @@ void nest::RecordingDevice::record_event(const Event& event, bool endrecord)
       std::cout << '\n';
   }
 
-  if ( P_.to_file_ )
+  if ( P_.to_file_ && P_.memory_mapped_ )
+    B_.mf_.append(sender, stamp.get_steps(), offset, weight);
+  else if ( P_.to_file_ && P_.columnar_ )
+  {
+    store_binary_(sender, stamp, offset, weight);
+    if ( endrecord )
+      end_binary_record_();
+  }
+  else if ( P_.to_file_ )
   {
     print_id_(B_.fs_, sender);
     print_time_(B_.fs_, stamp, offset);
@@ -599,6 +685,200 @@ void nest::RecordingDevice::store_data_(index sender, const Time& t, double offs
     S_.event_weights_.push_back(weight);
 }
 
+void nest::RecordingDevice::set_value_names(const std::vector<Name>& names)
+{
+  B_.bc_.value_names_ = names;
+}
+
+namespace {
+
+  // byte order mark of columnar files, written in native byte order
+  const uint32_t columns_byte_order = 0x01020304;
+
+  // numpy type string for the given type and size in native byte order
+  std::string native_dtype(char type, size_t size)
+  {
+    const char* const bom = reinterpret_cast<const char*>(&columns_byte_order);
+    std::string dtype(1, bom[0] == 0x04 ? '<' : '>');
+    dtype += type;
+    dtype += static_cast<char>('0' + size);
+    return dtype;
+  }
+
+}
+
+void nest::RecordingDevice::get_binary_columns_(std::vector<std::string>& names,
+                                                std::vector<std::string>& dtypes) const
+{
+  names.clear();
+  dtypes.clear();
+
+  const std::string u8 = native_dtype('u', sizeof(uint64_t));
+  const std::string i8 = native_dtype('i', sizeof(int64_t));
+  const std::string f8 = native_dtype('f', sizeof(double_t));
+
+  if ( P_.withgid_ )
+  {
+    names.push_back(names::senders.toString());
+    dtypes.push_back(u8);
+  }
+
+  if ( P_.withtime_ )
+  {
+    if ( P_.time_in_steps_ )
+    {
+      names.push_back("steps");
+      dtypes.push_back(i8);
+      if ( P_.precise_times_ )
+      {
+        names.push_back(names::offsets.toString());
+        dtypes.push_back(f8);
+      }
+    }
+    else
+    {
+      names.push_back(names::times.toString());
+      dtypes.push_back(f8);
+    }
+  }
+
+  if ( P_.withweight_ )
+  {
+    names.push_back(names::weights.toString());
+    dtypes.push_back(f8);
+  }
+
+  for ( size_t j = 0 ; j < B_.bc_.value_names_.size() ; ++j )
+  {
+    names.push_back(B_.bc_.value_names_[j].toString());
+    dtypes.push_back(f8);
+  }
+}
+
+void nest::RecordingDevice::store_binary_(index sender, const Time& t, double offs, double weight)
+{
+  BinaryColumns_& bc = B_.bc_;
+
+  if ( P_.withgid_ )
+    bc.senders_.push_back(sender);
+
+  if ( P_.withtime_ )
+  {
+    if ( P_.time_in_steps_ )
+    {
+      bc.steps_.push_back(t.get_steps());
+      if ( P_.precise_times_ )
+        bc.offsets_.push_back(offs);
+    }
+    else if ( P_.precise_times_ )
+      bc.times_.push_back(t.get_ms()-offs);
+    else
+      bc.times_.push_back(t.get_ms());
+  }
+
+  if ( P_.withweight_ )
+    bc.weights_.push_back(weight);
+}
+
+void nest::RecordingDevice::end_binary_record_()
+{
+  ++B_.bc_.n_records_;
+  if ( B_.bc_.n_records_ >= binary_block_size || P_.flush_records_ )
+  {
+    write_binary_block_();
+    if ( P_.flush_records_ )
+      B_.fs_.flush();
+  }
+}
+
+void nest::RecordingDevice::write_binary_header_()
+{
+  BinaryColumns_& bc = B_.bc_;
+  std::vector<std::string> dtypes;
+  get_binary_columns_(bc.names_, dtypes);
+
+  const uint32_t version = 2;
+  const uint32_t n_columns = bc.names_.size();
+  const uint32_t reserved = 0;
+  const double resolution = Time::get_resolution().get_ms();
+
+  B_.fs_.write("NESTCOLS", 8);
+  B_.fs_.write(reinterpret_cast<const char*>(&columns_byte_order), sizeof(columns_byte_order));
+  B_.fs_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  B_.fs_.write(reinterpret_cast<const char*>(&n_columns), sizeof(n_columns));
+  B_.fs_.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+  B_.fs_.write(reinterpret_cast<const char*>(&resolution), sizeof(resolution));
+
+  for ( size_t j = 0 ; j < bc.names_.size() ; ++j )
+  {
+    char name[32] = {0};
+    char dtype[8] = {0};
+    bc.names_[j].copy(name, sizeof(name) - 1);
+    dtypes[j].copy(dtype, sizeof(dtype) - 1);
+    B_.fs_.write(name, sizeof(name));
+    B_.fs_.write(dtype, sizeof(dtype));
+  }
+}
+
+namespace {
+
+  template <typename T>
+  void write_column(std::ostream& os, const std::vector<T>& column)
+  {
+    if ( !column.empty() )
+      os.write(reinterpret_cast<const char*>(&column[0]), column.size() * sizeof(T));
+  }
+
+}
+
+void nest::RecordingDevice::write_binary_block_()
+{
+  BinaryColumns_& bc = B_.bc_;
+  if ( bc.n_records_ == 0 )
+    return;
+
+  const uint64_t n_rows = bc.n_records_;
+  B_.fs_.write(reinterpret_cast<const char*>(&n_rows), sizeof(n_rows));
+
+  // column order as in get_binary_columns_()
+  write_column(B_.fs_, bc.senders_);
+  write_column(B_.fs_, bc.steps_);
+  write_column(B_.fs_, bc.offsets_);
+  write_column(B_.fs_, bc.times_);
+  write_column(B_.fs_, bc.weights_);
+
+  const size_t n_values = bc.value_names_.size();
+  assert(bc.values_.size() == n_rows * n_values);
+  bc.column_.resize(n_rows);
+  for ( size_t k = 0 ; k < n_values ; ++k )
+  {
+    for ( size_t r = 0 ; r < n_rows ; ++r )
+      bc.column_[r] = bc.values_[r * n_values + k];
+    write_column(B_.fs_, bc.column_);
+  }
+
+  bc.clear();
+
+  if ( !B_.fs_.good() )
+  {
+    std::string msg = String::compose("I/O error while writing file '%1'", P_.filename_);
+    Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::write_binary_block_()", msg);
+    throw IOError();
+  }
+}
+
+void nest::RecordingDevice::BinaryColumns_::clear()
+{
+  // clear() keeps the capacity for the next block
+  senders_.clear();
+  steps_.clear();
+  times_.clear();
+  offsets_.clear();
+  weights_.clear();
+  values_.clear();
+  n_records_ = 0;
+}
+
 const std::string nest::RecordingDevice::build_filename_() const
 {
   // number of digits in number of virtual processes
@@ -631,3 +911,151 @@ void nest::RecordingDevice::State_::clear_events()
   event_times_offsets_.clear();
   event_weights_.clear();
 }
+
+/* ----------------------------------------------------------------
+ * Memory-mapped spike files
+ * ---------------------------------------------------------------- */
+
+namespace {
+
+  // layout of memory-mapped spike files, see /memory_mapped;
+  // nest.recordings in PyNEST relies on this layout. All integer
+  // fields have fixed width, long long being 64 bit on all supported
+  // platforms; byte_order lets readers detect the byte order.
+  struct MappedHeader
+  {
+    char               magic[8];    // "NESTMMAP", not null-terminated
+    unsigned int       byte_order;  // mapped_file_byte_order, in native byte order
+    unsigned int       version;
+    unsigned int       record_size;
+    unsigned int       reserved;    // zero, pads n_records to 8 bytes
+    unsigned long long n_records;
+    double             resolution;  // in ms
+  };
+
+  struct MappedRecord
+  {
+    unsigned long long gid;
+    long long          step;
+    double             offset;
+    double             weight;
+  };
+
+  const unsigned int mapped_file_byte_order = 0x01020304;
+  const unsigned int mapped_file_version = 2;
+  const size_t mapped_file_initial_capacity = 1 << 16;  // records
+
+}
+
+nest::RecordingDevice::MappedFile_::MappedFile_()
+  : fd_(-1),
+    data_(0),
+    capacity_(0),
+    n_(0)
+{}
+
+nest::RecordingDevice::MappedFile_::~MappedFile_()
+{
+  close();
+}
+
+bool nest::RecordingDevice::MappedFile_::open(const std::string& filename)
+{
+  assert(!is_open());
+  assert(sizeof(MappedHeader) == 40 && sizeof(MappedRecord) == 32);
+
+  fd_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if ( fd_ < 0 )
+    return false;
+
+  n_ = 0;
+  if ( !map_(mapped_file_initial_capacity) )
+  {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+
+  MappedHeader* const h = reinterpret_cast<MappedHeader*>(data_);
+  std::memcpy(h->magic, "NESTMMAP", sizeof(h->magic));
+  h->byte_order = mapped_file_byte_order;
+  h->version = mapped_file_version;
+  h->record_size = sizeof(MappedRecord);
+  h->reserved = 0;
+  h->n_records = 0;
+  h->resolution = Time::get_resolution().get_ms();
+
+  return true;
+}
+
+void nest::RecordingDevice::MappedFile_::close()
+{
+  if ( !is_open() )
+    return;
+
+  unmap_();
+
+  // drop the unused capacity
+  if ( ftruncate(fd_, sizeof(MappedHeader) + n_ * sizeof(MappedRecord)) != 0 )
+    Node::network()->message(SLIInterpreter::M_WARNING, "RecordingDevice::MappedFile_::close()",
+                             "Could not truncate memory-mapped file.");
+  ::close(fd_);
+  fd_ = -1;
+  capacity_ = 0;
+  n_ = 0;
+}
+
+void nest::RecordingDevice::MappedFile_::append(index gid, long step, double offset, double weight)
+{
+  assert(is_open());
+
+  if ( n_ == capacity_ )
+  {
+    unmap_();
+    if ( !map_(2 * capacity_) )
+    {
+      Node::network()->message(SLIInterpreter::M_ERROR, "RecordingDevice::MappedFile_::append()",
+                               "Could not grow memory-mapped file.");
+      throw IOError();
+    }
+  }
+
+  MappedRecord* const r =
+    reinterpret_cast<MappedRecord*>(data_ + sizeof(MappedHeader)) + n_;
+  r->gid = gid;
+  r->step = step;
+  r->offset = offset;
+  r->weight = weight;
+
+  reinterpret_cast<MappedHeader*>(data_)->n_records = ++n_;
+}
+
+void nest::RecordingDevice::MappedFile_::sync()
+{
+  if ( data_ != 0 )
+    msync(data_, sizeof(MappedHeader) + capacity_ * sizeof(MappedRecord), MS_ASYNC);
+}
+
+bool nest::RecordingDevice::MappedFile_::map_(size_t capacity)
+{
+  assert(data_ == 0);
+
+  const size_t size = sizeof(MappedHeader) + capacity * sizeof(MappedRecord);
+  if ( ftruncate(fd_, size) != 0 )
+    return false;
+
+  void* p = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if ( p == MAP_FAILED )
+    return false;
+
+  data_ = static_cast<char*>(p);
+  capacity_ = capacity;
+  return true;
+}
+
+void nest::RecordingDevice::MappedFile_::unmap_()
+{
+  if ( data_ != 0 )
+    munmap(data_, sizeof(MappedHeader) + capacity_ * sizeof(MappedRecord));
+  data_ = 0;
+}
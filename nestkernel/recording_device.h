@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <fstream>
+#include <stdint.h>
 
 namespace nest {
 
@@ -152,9 +153,35 @@ namespace nest {
     /precision     - number of digits to use in output of doubles to file (default: 3)
     /binary        - if set to true, data is written in binary mode to files instead of ASCII.
                      This setting affects file output only, not screen output (default: false)
+    /columnar      - if set to true, data is written to files in a binary columnar format
+                     instead of ASCII. The file starts with the magic string NESTCOLS, the
+                     byte order mark 0x01020304, the format version, the number of columns
+                     and a reserved field (unsigned 32 bit each), and the resolution in ms
+                     (double), followed by one entry per column consisting of the column
+                     name (32 bytes) and its numpy type string (8 bytes), both null-padded.
+                     Columns are, as selected by the flags above, /senders, /steps and
+                     /offsets or /times, /weights and one column per recorded analog
+                     quantity. The data follows in blocks, each holding the number of rows
+                     (unsigned 64 bit) and then the data of each column in turn. All values
+                     are in the byte order of the writing machine, which the type strings
+                     give as well.
+                     Formatting parameters are ignored. Files can be read with
+                     nest.recordings.read_columns(). This setting affects file output only,
+                     not screen output (default: false)
     /fbuffer_size  - the size of the buffer to use for writing to files. The default size is
                      determined by the implementation of the C++ standard library. To obtain an
                      unbuffered file stream, use a buffer size of 0.
+    /memory_mapped - spike detectors only: if set to true, file output is written as fixed-size
+                     binary records into a memory-mapped file instead of formatted text. All
+                     formatting parameters are ignored; each record holds the sender GID
+                     (unsigned 64 bit), the time step (signed 64 bit), the offset and the
+                     weight (both double), preceded by a 40 byte header with the magic string
+                     NESTMMAP, the byte order mark 0x01020304, the format version, the record
+                     size and a reserved field (unsigned 32 bit each), the number of records
+                     (unsigned 64 bit) and the resolution in ms (double). All values are in
+                     the byte order of the writing machine. The file can be read while open,
+                     e.g. with nest.recordings.read_mapped_spikes(). Takes precedence over
+                     /columnar (default: false)
 
     Data recorded in memory is available through the following parameter:
     /n_events      - Number of events collected or sampled. n_events can be set to 0, but
@@ -274,6 +301,16 @@ namespace nest {
      * @param endrecord pass false if more data is to come on same line
      */
     void record_event(const Event&, bool endrecord = true);
+
+    /**
+     * Record sender, time stamp, offset and weight of one event.
+     *
+     * Devices that buffer events in compact form instead of keeping
+     * the Event objects call this version.
+     * @param endrecord pass false if more data is to come on same line
+     */
+    void record_event(index sender, const Time& stamp, double offset, double weight,
+                      bool endrecord = true);
     
     /**
      * Print single item of type ValueT.
@@ -283,6 +320,13 @@ namespace nest {
     template <typename ValueT>
     void print_value(const ValueT&, bool endrecord = true);
 
+    /**
+     * Set names of the values passed to print_value() for each record.
+     * They are used as column names in columnar files, so devices printing
+     * values must pass one name per value before calibrate().
+     */
+    void set_value_names(const std::vector<Name>&);
+
     /** Indicate if recording device is active.
      *  The argument is the time stamp of the event, and the
      *  device is active if start_ < T <= stop_.
@@ -371,11 +415,121 @@ namespace nest {
      *       any data member.
      */
     const std::string build_filename_() const;
+
+    /**
+     * Open output file, either as stream or memory-mapped.
+     * Throws IOError if the file exists and may not be overwritten,
+     * or if it cannot be opened.
+     */
+    void open_file_();
+
+    /**
+     * Close output file, whether stream or memory-mapped.
+     */
+    void close_file_();
+
+    bool file_is_open_() const;
+
+    /**
+     * Column names and numpy type strings of columnar files for the
+     * current settings.
+     */
+    void get_binary_columns_(std::vector<std::string>& names,
+                             std::vector<std::string>& dtypes) const;
+
+    /**
+     * Store one record in the column buffers for columnar output.
+     */
+    void store_binary_(index, const Time&, double, double);
+
+    /**
+     * Complete the current record in columnar output, write block if full.
+     */
+    void end_binary_record_();
+
+    /**
+     * Write the header of a columnar file.
+     */
+    void write_binary_header_();
+
+    /**
+     * Write all buffered records as one block to a columnar file.
+     */
+    void write_binary_block_();
  
     // ------------------------------------------------------------------
-    
+
+    /**
+     * Output file of fixed-size binary spike records, see /memory_mapped.
+     *
+     * The file is grown by doubling and mapped into memory, so that
+     * recording a spike is a plain memory write. The record count in
+     * the header is updated with every record, so that readers see all
+     * records written so far. On close, the file is truncated to the
+     * records written.
+     */
+    class MappedFile_ {
+    public:
+      MappedFile_();
+      ~MappedFile_();
+
+      bool is_open() const { return fd_ >= 0; }
+
+      /**
+       * Create and map the file, returns false on failure.
+       */
+      bool open(const std::string& filename);
+      void close();
+      void append(index gid, long step, double offset, double weight);
+
+      /**
+       * Schedule write-back of the mapped pages to disk.
+       */
+      void sync();
+
+    private:
+      MappedFile_(const MappedFile_&);             //!< not implemented
+      MappedFile_& operator=(const MappedFile_&);  //!< not implemented
+
+      bool map_(size_t capacity);  //!< (re)map file for given number of records
+      void unmap_();
+
+      int    fd_;       //!< file descriptor, -1 if closed
+      char*  data_;     //!< start of mapping
+      size_t capacity_; //!< number of records the mapping can hold
+      size_t n_;        //!< number of records written
+    };
+
+    /**
+     * Column buffers for columnar output, see /columnar.
+     *
+     * Records are collected column by column and written to the file
+     * stream as one block once binary_block_size records are buffered,
+     * so that output needs few large writes. Each device instance, i.e.,
+     * each thread, writes its own file and buffers.
+     */
+    struct BinaryColumns_ {
+      std::vector<std::string> names_;   //!< column names in file order
+      std::vector<Name> value_names_;    //!< names of analog values
+      std::vector<uint64_t> senders_;    //!< fixed width, as declared in the file
+      std::vector<int64_t>  steps_;
+      std::vector<double_t> times_;      //!< in ms
+      std::vector<double_t> offsets_;
+      std::vector<double_t> weights_;
+      std::vector<double_t> values_;     //!< analog values, record by record
+      std::vector<double_t> column_;     //!< scratch space for writing values_
+      size_t n_records_;                 //!< number of complete records buffered
+
+      BinaryColumns_();
+      void clear();  //!< drop all buffered records
+    };
+
+    static const size_t binary_block_size;  //!< records per block in binary files
+
     struct Buffers_ {
       std::ofstream fs_; //!< the file to write the recorded data to
+      MappedFile_   mf_; //!< memory-mapped file, used instead of fs_ if /memory_mapped
+      BinaryColumns_ bc_; //!< buffered records if /columnar
     };
 
     // ------------------------------------------------------------------
@@ -395,8 +549,10 @@ namespace nest {
       bool scientific_;    //!< use scientific format if true, else fixed
 
       bool binary_;            //!< true if to write files in binary mode instead of ASCII   
+      bool columnar_;          //!< true if to write files in binary columnar format instead of ASCII
       long fbuffer_size_;      //!< the buffer size to use when writing to file
       long fbuffer_size_old_;  //!< the buffer size to use when writing to file (old)
+      bool memory_mapped_;     //!< true if to write spike records to a memory-mapped file
 
       std::string label_;    //!< a user-defined label for symbolic device names.
       std::string file_ext_; //!< the file name extension to use, without .
@@ -483,7 +639,13 @@ void RecordingDevice::print_value(const ValueT& value, bool endrecord)
       std::cout << '\n';
   }
 
-  if ( P_.to_file_ )
+  if ( P_.to_file_ && P_.columnar_ )
+  {
+    B_.bc_.values_.push_back(value);
+    if ( endrecord )
+      end_binary_record_();
+  }
+  else if ( P_.to_file_ )
   {
     B_.fs_ << value << '\t';
     if ( endrecord )
@@ -21,25 +21,111 @@
  */
 
 #include "ring_buffer.h"
-                
-nest::RingBuffer::RingBuffer()
-  : buffer_(0.0, Scheduler::get_min_delay()+Scheduler::get_max_delay())
+
+nest::BufferStorage::BufferStorage()
+  : data_(0),
+    size_(0),
+    arena_(0)
 {}
 
-void nest::RingBuffer::resize()
+nest::BufferStorage::BufferStorage(const BufferStorage& b)
+  : data_(0),
+    size_(0),
+    arena_(0)
 {
-  size_t size = Scheduler::get_min_delay()+Scheduler::get_max_delay();
-  if (buffer_.size() != size)
+  *this = b;
+}
+
+nest::BufferStorage::~BufferStorage()
+{
+  release_();
+}
+
+nest::BufferStorage& nest::BufferStorage::operator=(const BufferStorage& b)
+{
+  if ( &b == this )
+    return *this;
+
+  // copies hold their entries on the heap
+  release_();
+  if ( b.size_ > 0 )
   {
-    buffer_.resize(size);
-    buffer_ = 0.0;
+    data_ = new double_t[b.size_];
+    std::copy(b.data_, b.data_ + b.size_, data_);
   }
+  size_ = b.size_;
+  return *this;
+}
+
+void nest::BufferStorage::release_()
+{
+  if ( arena_ )
+    arena_->free(data_, size_ * sizeof(double_t));
+  else
+    delete [] data_;
+
+  data_ = 0;
+  size_ = 0;
+  arena_ = 0;
+}
+
+void nest::BufferStorage::resize(size_t n)
+{
+  if ( size_ == n && arena_ == 0 )
+    return;
+
+  double_t* const data = n > 0 ? new double_t[n] : 0;
+  if ( size_ == n )
+    std::copy(data_, data_ + n, data);
+  else
+    std::fill(data, data + n, 0.0);
+
+  release_();
+  data_ = data;
+  size_ = n;
+}
+
+void nest::BufferStorage::resize(size_t n, sli::arena& arena)
+{
+  if ( size_ == n && arena_ == &arena )
+    return;
+
+  double_t* const data = static_cast<double_t*>(arena.alloc(n * sizeof(double_t)));
+  if ( size_ == n )
+    std::copy(data_, data_ + n, data);
+  else
+    std::fill(data, data + n, 0.0);
+
+  release_();
+  data_ = data;
+  size_ = n;
+  arena_ = &arena;
+}
+
+nest::RingBuffer::RingBuffer()
+  : buffer_()
+{}
+
+void nest::RingBuffer::resize()
+{
+  buffer_.resize(Scheduler::get_min_delay()+Scheduler::get_max_delay());
+}
+
+void nest::RingBuffer::resize(sli::arena& arena)
+{
+  buffer_.resize(Scheduler::get_min_delay()+Scheduler::get_max_delay(), arena);
 }
 
 void nest::RingBuffer::clear()
 {
-  resize();    // does nothing if size is fine
-  buffer_=0.0; // clear all elements
+  resize();        // does nothing if size is fine
+  buffer_.clear(); // clear all elements
+}
+
+void nest::RingBuffer::clear(sli::arena& arena)
+{
+  resize(arena);   // does nothing if size is fine
+  buffer_.clear(); // clear all elements
 }
 
 
@@ -22,15 +22,67 @@
 
 #ifndef RING_BUFFER_H
 #define RING_BUFFER_H
+#include <algorithm>
 #include <valarray>
+#include <vector>
 #include <list>
 #include "nest.h"
 #include "scheduler.h"
 #include "nest_time.h"
+#include "allocator.h"
 
 namespace nest
 {
 
+  /**
+   * Storage for the entries of RingBuffer and MultiChannelInputBuffer.
+   * The entries lie on the heap, or in an arena such as the buffer arena
+   * of the model of the node, see Node::get_buffer_arena_(). Buffers of
+   * consecutively initialized nodes are then contiguous in memory.
+   * Entries in an arena are returned to it when the storage is resized
+   * or destroyed, so that the arena hands them out again. Storage is
+   * empty until resized, and copies hold their entries on the heap.
+   * @note An arena must outlive the storage using it, as the arenas of
+   *       a model outlive its nodes.
+   */
+  class BufferStorage {
+  public:
+
+    BufferStorage();
+    BufferStorage(const BufferStorage&);
+    ~BufferStorage();
+    BufferStorage& operator=(const BufferStorage&);
+
+    /**
+     * Hold n entries on the heap.
+     * If the number of entries changes, all entries are set to nought,
+     * otherwise they are kept.
+     */
+    void resize(size_t n);
+
+    /**
+     * Hold n entries in the given arena, with entries as for resize(size_t).
+     */
+    void resize(size_t n, sli::arena&);
+
+    //! Set all entries to nought
+    void clear() { std::fill(data_, data_ + size_, 0.0); }
+
+    size_t size() const { return size_; }
+
+    double_t& operator[](size_t i) { return data_[i]; }
+    const double_t& operator[](size_t i) const { return data_[i]; }
+
+  private:
+
+    double_t*   data_;   //!< entries
+    size_t      size_;   //!< number of entries
+    sli::arena* arena_;  //!< arena holding the entries, 0 if on the heap
+
+    //! Return the entries to the heap or arena
+    void release_();
+  };
+
 /**
    Buffer Layout.
 
@@ -86,6 +138,26 @@ namespace nest
      */
     void add_value(const long_t offs, const double_t);
 
+    /**
+     * Add several values to the ring buffer.
+     * Value v[i] is added at offs + lags[i]. The lags must lie in
+     * [0, min_delay), so that the buffer index is looked up only once.
+     * @param  offs     Arrival time for lag 0 relative to beginning of slice.
+     * @param  lags     Lags of the values.
+     * @param  v        Values to add.
+     * @param  n        Number of values.
+     */
+    void add_values(const long_t offs, const long_t* lags, const double_t* v, const size_t n);
+
+    /**
+     * Add several multiples of one value to the ring buffer.
+     * Adds weight * counts[i] at offs + lags[i], as add_value() would for
+     * spikes of weight and multiplicity counts[i].
+     * @see add_values(const long_t, const long_t*, const double_t*, const size_t)
+     */
+    void add_values(const long_t offs, const long_t* lags, const long* counts,
+                    const double_t weight, const size_t n);
+
     /**
      * Set a ring buffer entry to a given value.
      * @param  offs     Arrival time relative to beginning of slice.
@@ -106,6 +178,12 @@ namespace nest
      */
     void clear();
 
+    /**
+     * Initialize the buffer with noughts, with its entries in the given
+     * arena, see BufferStorage.
+     */
+    void clear(sli::arena&);
+
     /**
      * Resize the buffer according to max_thread and max_delay.
      * New elements are filled with noughts.
@@ -113,6 +191,13 @@ namespace nest
      */
     void resize();
 
+    /**
+     * Resize the buffer, with its entries in the given arena.
+     * @note resize() has no effect if the buffer has the correct size
+     *       and lies in the arena.
+     */
+    void resize(sli::arena&);
+
     /**
      * Returns buffer size, for memory measurement.
      */
@@ -120,8 +205,8 @@ namespace nest
 
   private:        
 
-    //! Buffered data
-    std::valarray<double_t> buffer_;
+    //! Buffered data, empty until the buffer is cleared or resized
+    BufferStorage buffer_;
 
     /**
      * Obtain buffer index.
@@ -139,6 +224,37 @@ namespace nest
     buffer_[get_index_(offs)] += v;
   }
 
+  inline
+  void RingBuffer::add_values(const long_t offs, const long_t* lags, const double_t* v, const size_t n)
+  {
+    const size_t size = buffer_.size();
+    const size_t base = get_index_(offs);
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      assert(0 <= lags[i] && (delay)lags[i] < Scheduler::get_min_delay());
+      size_t idx = base + lags[i];
+      if ( idx >= size )
+        idx -= size;
+      buffer_[idx] += v[i];
+    }
+  }
+
+  inline
+  void RingBuffer::add_values(const long_t offs, const long_t* lags, const long* counts,
+                              const double_t weight, const size_t n)
+  {
+    const size_t size = buffer_.size();
+    const size_t base = get_index_(offs);
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      assert(0 <= lags[i] && (delay)lags[i] < Scheduler::get_min_delay());
+      size_t idx = base + lags[i];
+      if ( idx >= size )
+        idx -= size;
+      buffer_[idx] += weight * counts[i];
+    }
+  }
+
   inline
   void RingBuffer::set_value(const long_t offs, const double_t v)
   {
@@ -171,6 +287,174 @@ namespace nest
 
 
 
+  /**
+   * Ring buffer for several input channels of a neuron.
+   * Holds num_channels ring buffers with their entries interleaved, so
+   * that all channels of one time step lie next to each other in memory,
+   * e.g. excitatory and inhibitory spike input. Reading the input of a
+   * step then touches a single cache line instead of one per channel.
+   * Indexing follows RingBuffer.
+   *
+   * The buffer is empty until resized. Its entries can lie in an arena,
+   * see BufferStorage.
+   */
+  template < unsigned int num_channels >
+  class MultiChannelInputBuffer {
+  public:
+
+    MultiChannelInputBuffer();
+
+    /**
+     * Add a value to one channel of the ring buffer.
+     * @param  offs     Arrival time relative to beginning of slice.
+     * @param  channel  Channel to add to.
+     * @param  v        Value to add.
+     */
+    void add_value(const long_t offs, const size_t channel, const double_t v);
+
+    /**
+     * Add several multiples of one value to one channel.
+     * @see RingBuffer::add_values()
+     */
+    void add_values(const long_t offs, const size_t channel, const long_t* lags,
+                    const long* counts, const double_t weight, const size_t n);
+
+    /**
+     * Read the values of all channels for one step and clear them.
+     * @param  offs    Offset of element to read within slice.
+     * @param  values  Array of num_channels elements receiving the values.
+     */
+    void get_values(const long_t offs, double_t* values);
+
+    /**
+     * Initialize the buffer with noughts.
+     * Also resizes the buffer if necessary.
+     */
+    void clear();
+
+    /**
+     * Initialize the buffer with noughts, with its entries in the given
+     * arena.
+     */
+    void clear(sli::arena&);
+
+    /**
+     * Resize the buffer according to min_delay and max_delay.
+     * New elements are filled with noughts.
+     * @note resize() has no effect if the buffer has the correct size.
+     */
+    void resize();
+
+    /**
+     * Resize the buffer, with its entries in the given arena.
+     * @note resize() has no effect if the buffer has the correct size
+     *       and lies in the arena.
+     */
+    void resize(sli::arena&);
+
+    /**
+     * Returns buffer size, for memory measurement.
+     */
+    size_t size() const { return buffer_.size(); }
+
+  private:
+
+    //! Buffered data, num_channels entries per step
+    BufferStorage buffer_;
+
+    /**
+     * Obtain index of the first channel of a step.
+     * @param delay delivery delay for event
+     */
+    size_t get_index_(const delay d) const;
+
+  };
+
+  template < unsigned int num_channels >
+  MultiChannelInputBuffer<num_channels>::MultiChannelInputBuffer()
+    : buffer_()
+  {}
+
+  template < unsigned int num_channels >
+  void MultiChannelInputBuffer<num_channels>::resize()
+  {
+    buffer_.resize(num_channels * (Scheduler::get_min_delay() + Scheduler::get_max_delay()));
+  }
+
+  template < unsigned int num_channels >
+  void MultiChannelInputBuffer<num_channels>::resize(sli::arena& arena)
+  {
+    buffer_.resize(num_channels * (Scheduler::get_min_delay() + Scheduler::get_max_delay()),
+                   arena);
+  }
+
+  template < unsigned int num_channels >
+  void MultiChannelInputBuffer<num_channels>::clear()
+  {
+    resize();  // does nothing if size is fine
+    buffer_.clear();
+  }
+
+  template < unsigned int num_channels >
+  void MultiChannelInputBuffer<num_channels>::clear(sli::arena& arena)
+  {
+    resize(arena);  // does nothing if size is fine
+    buffer_.clear();
+  }
+
+  template < unsigned int num_channels >
+  inline
+  void MultiChannelInputBuffer<num_channels>::add_value(const long_t offs, const size_t channel,
+                                                        const double_t v)
+  {
+    assert(channel < num_channels);
+    buffer_[get_index_(offs) + channel] += v;
+  }
+
+  template < unsigned int num_channels >
+  inline
+  void MultiChannelInputBuffer<num_channels>::add_values(const long_t offs, const size_t channel,
+                                                         const long_t* lags, const long* counts,
+                                                         const double_t weight, const size_t n)
+  {
+    assert(channel < num_channels);
+    const size_t size = buffer_.size();
+    const size_t base = get_index_(offs) + channel;
+    for ( size_t i = 0 ; i < n ; ++i )
+    {
+      assert(0 <= lags[i] && (delay)lags[i] < Scheduler::get_min_delay());
+      size_t idx = base + num_channels * lags[i];
+      if ( idx >= size )
+        idx -= size;
+      buffer_[idx] += weight * counts[i];
+    }
+  }
+
+  template < unsigned int num_channels >
+  inline
+  void MultiChannelInputBuffer<num_channels>::get_values(const long_t offs, double_t* values)
+  {
+    assert((delay)offs < Scheduler::get_min_delay());
+
+    double_t* const entry = &buffer_[get_index_(offs)];
+    for ( size_t c = 0 ; c < num_channels ; ++c )
+    {
+      values[c] = entry[c];
+      entry[c] = 0.0;  // clear buffer after reading
+    }
+  }
+
+  template < unsigned int num_channels >
+  inline
+  size_t MultiChannelInputBuffer<num_channels>::get_index_(const delay d) const
+  {
+    const size_t idx = num_channels * Scheduler::get_modulo(d);
+    assert(idx < buffer_.size());
+    return idx;
+  }
+
+
+
   class MultRBuffer {
   public:
     
@@ -20,6 +20,7 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <sstream>
@@ -66,6 +67,21 @@ extern PoorMansAllocator poormansallocpool;
 
 extern int SLIsignalflag;
 
+namespace
+{
+  // Access GIDs of on-grid and off-grid spike buffer entries alike, and
+  // create entries from GID and offset, as required when collocating the
+  // spike register into either kind of send buffer.
+  inline nest::uint_t get_spike_gid_(const nest::uint_t s) { return s; }
+  inline nest::uint_t get_spike_gid_(const nest::OffGridSpike& s) { return s.get_gid(); }
+
+  inline void make_spike_(const nest::uint_t gid, const nest::double_t, nest::uint_t& d) { d = gid; }
+  inline void make_spike_(const nest::uint_t gid, const nest::double_t offset, nest::OffGridSpike& d) { d = nest::OffGridSpike(gid, offset); }
+
+  inline nest::double_t get_spike_offset_(const nest::uint_t) { return 0.0; }
+  inline nest::double_t get_spike_offset_(const nest::OffGridSpike& s) { return s.get_offset(); }
+}
+
 nest::Network* nest::Scheduler::net_ = 0;
 
 std::vector<nest::delay> nest::Scheduler::moduli_;
@@ -95,7 +111,15 @@ nest::Scheduler::Scheduler(Network &net)
           terminate_(false),
           off_grid_spiking_(false),
           print_time_(false),
-          rng_()
+          pipelined_comm_(false),
+          comm_in_flight_(false),
+          population_update_(false),
+          sort_spikes_by_source_(false),
+          vp_independent_rng_(false),
+          rng_purposes_(0),
+          rng_(),
+          remote_targets_valid_(false),
+          thread_targets_valid_(false)
 {
   net_ = &net;
   init_();
@@ -131,6 +155,12 @@ void nest::Scheduler::init_()
   assert(initialized_ == false);
 
   simulated_ = false;
+  remote_targets_valid_ = false;
+  thread_targets_valid_ = false;
+  comm_in_flight_ = false;
+  rng_purposes_ = 0;
+  comm_hidden_timer_.reset();
+  comm_wait_timer_.reset();
 
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
@@ -148,6 +178,9 @@ void nest::Scheduler::init_()
 
   set_num_threads(n_threads_);
 
+  connector_lookups_.assign(n_threads_, 0);
+  delivery_timers_.assign(n_threads_, Stopwatch());
+
   n_sim_procs_ = Communicator::get_num_processes()-n_rec_procs_;
 
   // explicitly force construction of nodes_vec_ to ensure consistent state
@@ -254,20 +287,8 @@ void nest::Scheduler::configure_spike_buffers_()
   assert(min_delay_ != 0);
 
   spike_register_.clear();
-  // the following line does not compile with gcc <= 3.3.5
-  spike_register_.resize(n_threads_,
-      std::vector<std::vector<uint_t> >(min_delay_));
-  for (size_t j = 0; j < spike_register_.size(); ++j)
-    for (size_t k = 0; k < spike_register_[j].size(); ++k)
-      spike_register_[j][k].clear();
-
-  offgrid_spike_register_.clear();
-  // the following line does not compile with gcc <= 3.3.5
-  offgrid_spike_register_.resize(n_threads_,
-      std::vector<std::vector<OffGridSpike> >(min_delay_));
-  for (size_t j = 0; j < offgrid_spike_register_.size(); ++j)
-    for (size_t k = 0; k < offgrid_spike_register_[j].size(); ++k)
-      offgrid_spike_register_[j][k].clear();
+  spike_register_.resize(n_threads_);
+  spike_register_pos_.assign(n_threads_ * min_delay_, 0);
 
   //send_buffer must be >= 2 as the 'overflow' signal takes up 2 spaces.
   int send_buffer_size =
@@ -442,6 +463,24 @@ void nest::Scheduler::resume()
     print_progress_();
   }
 
+  // rebuild lookup tables for spike delivery if connections were
+  // created since the last call, also when resuming after an interrupt
+  if ( net_->connection_manager_.get_connectivity_changed() )
+  {
+    remote_targets_valid_ = false;
+    thread_targets_valid_ = false;
+    net_->connection_manager_.finalize_connections();
+    net_->connection_manager_.reset_connectivity_changed();
+  }
+
+  update_thread_targets_();
+
+  if ( Communicator::get_use_Alltoallv() )
+    update_remote_targets_();
+
+  if ( pipelined_comm_ )
+    update_independent_nodes_();
+
   simulating_ = true;
   simulated_ = true;
 
@@ -500,6 +539,21 @@ void nest::Scheduler::update()
       if (print_time_)
         gettimeofday(&t_slice_begin_, NULL);
 
+      // With pipelined communication, nodes without incoming connections
+      // are updated while the spikes of the previous slice are exchanged.
+      // comm_in_flight_ is only changed in the single section at the end
+      // of the loop, so all threads take the same branch here.
+      const bool overlap = from_step_ == 0 && comm_in_flight_;
+      if (overlap)
+      {
+        update_nodes_(independent_nodes_vec_[t], t, exceptions_raised);
+
+#pragma omp single
+        {
+          finish_gather_events_();
+        }
+      }
+
       if (from_step_ == 0) // deliver only at beginning of slice
       {
         deliver_events_(t);
@@ -528,31 +582,20 @@ void nest::Scheduler::update()
 #endif
       }
 
-      for (i = nodes_vec_[t].begin(); i != nodes_vec_[t].end(); ++i)
-      {
-    	// We update in a parallel region. Therefore, we need to catch exceptions
-    	// here and then handle them after the parallel region.
-        try
-        {
-          if ( not (*i)->is_frozen() )
-          	  (*i)->update(clock_, from_step_, to_step_);
-        }
-        catch ( std::exception &e )
-        {
-          // so throw the exception after parallel region
-          exceptions_raised.at(t) = lockPTR<WrappedThreadException>(
-                                        new WrappedThreadException(e));
-          terminate_ = true;
-        }
-      }
+      update_nodes_(overlap ? dependent_nodes_vec_[t] : nodes_vec_[t], t, exceptions_raised);
 
       // parallel section ends, wait until all threads are done -> synchronize
 #pragma omp barrier
 
+      // all threads copy their spikes into the send buffer
+      if (to_step_ == min_delay_ && !Communicator::get_use_Alltoallv())
+        collocate_buffers_(t);
+
       // the following block is executed by a single thread
       // the other threads wait at the end of the block
 #pragma omp single
       {
+        comm_in_flight_ = false;
         if (to_step_ == min_delay_) // gather only at end of slice
           gather_events_();
 
@@ -577,12 +620,71 @@ void nest::Scheduler::update()
     while ((to_do_ != 0) && (! terminate_));
 
   } // end of #pragma parallel omp
+
+  // complete a pending spike exchange, so that buffers are consistent
+  // between calls to Simulate
+  if (comm_in_flight_)
+  {
+    finish_gather_events_();
+    comm_in_flight_ = false;
+  }
+
   // check if any exceptions have been raised
   for ( thread thr = 0 ; thr < net_->get_num_threads() ; ++thr )
     if ( exceptions_raised.at(thr).valid() )
       throw WrappedThreadException(*(exceptions_raised.at(thr)));
 }
 
+void nest::Scheduler::update_nodes_(const vector<Node*>& nodes, thread t,
+                                    vector<lockPTR<WrappedThreadException> >& exceptions_raised)
+{
+  for (vector<Node*>::const_iterator i = nodes.begin(); i != nodes.end(); ++i)
+  {
+    // We update in a parallel region. Therefore, we need to catch exceptions
+    // here and then handle them after the parallel region.
+    try
+    {
+      if ( population_update_ && (*i)->has_population_update() && not (*i)->is_frozen() )
+      {
+        // update the run of nodes of the same model starting here at once
+        vector<Node*>::const_iterator last = i + 1;
+        while ( last != nodes.end() && (*last)->get_model_id() == (*i)->get_model_id()
+                && (*last)->has_population_update() && not (*last)->is_frozen() )
+          ++last;
+
+        (*i)->update_population(&(*i), last - i, clock_, from_step_, to_step_);
+        i = last - 1;
+      }
+      else if ( not (*i)->is_frozen() )
+        (*i)->update(clock_, from_step_, to_step_);
+    }
+    catch ( std::exception &e )
+    {
+      // so throw the exception after parallel region
+      exceptions_raised.at(t) = lockPTR<WrappedThreadException>(
+                                    new WrappedThreadException(e));
+      terminate_ = true;
+    }
+  }
+}
+
+void nest::Scheduler::update_independent_nodes_()
+{
+  independent_nodes_vec_.clear();
+  independent_nodes_vec_.resize(n_threads_);
+  dependent_nodes_vec_.clear();
+  dependent_nodes_vec_.resize(n_threads_);
+
+  // Nodes with incoming connections may receive spikes in the first
+  // step of a slice, so they cannot be updated before delivery.
+  for (index t = 0; t < n_threads_; ++t)
+    for (vector<Node*>::const_iterator i = nodes_vec_[t].begin(); i != nodes_vec_[t].end(); ++i)
+      if ( (*i)->has_incoming_connections() )
+        dependent_nodes_vec_[t].push_back(*i);
+      else
+        independent_nodes_vec_[t].push_back(*i);
+}
+
 void nest::Scheduler::prepare_nodes()
 {
   assert(initialized_);
@@ -930,6 +1032,15 @@ void nest::Scheduler::set_status(DictionaryDatum const &d)
   if (commstyle_updated)
     Communicator::set_use_Allgather(comm_allgather);
 
+  bool comm_alltoallv;
+  if (updateValue<bool>(d, "communicate_alltoallv", comm_alltoallv))
+    Communicator::set_use_Alltoallv(comm_alltoallv);
+
+  updateValue<bool>(d, "pipelined_communication", pipelined_comm_);
+  updateValue<bool>(d, "population_update", population_update_);
+  updateValue<bool>(d, "sort_spikes_by_source", sort_spikes_by_source_);
+  updateValue<bool>(d, "vp_independent_rng", vp_independent_rng_);
+
   // set RNGs --- MUST come after n_threads_ is updated
   if (d->known("rngs"))
   {
@@ -1093,6 +1204,23 @@ void nest::Scheduler::get_status(DictionaryDatum &d) const
   def<long>(d, "grng_seed", grng_seed_);
   def<bool>(d, "off_grid_spiking", off_grid_spiking_);
   def<bool>(d, "communicate_allgather", Communicator::get_use_Allgather());
+  def<bool>(d, "communicate_alltoallv", Communicator::get_use_Alltoallv());
+  def<bool>(d, "pipelined_communication", pipelined_comm_);
+  def<double>(d, "communication_time_hidden", comm_hidden_timer_.elapsed(Stopwatch::MILLISEC));
+  def<double>(d, "communication_time_waited", comm_wait_timer_.elapsed(Stopwatch::MILLISEC));
+  def<bool>(d, "population_update", population_update_);
+
+  def<bool>(d, "sort_spikes_by_source", sort_spikes_by_source_);
+  def<bool>(d, "vp_independent_rng", vp_independent_rng_);
+  long connector_lookups = 0;
+  double_t delivery_time = 0.0;
+  for (size_t t = 0; t < connector_lookups_.size(); ++t)
+  {
+    connector_lookups += connector_lookups_[t];
+    delivery_time = std::max(delivery_time, delivery_timers_[t].elapsed(Stopwatch::MILLISEC));
+  }
+  def<long>(d, "connector_lookups", connector_lookups);
+  def<double>(d, "delivery_time", delivery_time);
   def<long>(d, "send_buffer_size", Communicator::get_send_buffer_size());
   def<long>(d, "receive_buffer_size", Communicator::get_recv_buffer_size());
 }
@@ -1112,6 +1240,7 @@ void nest::Scheduler::create_rngs_(const bool ctor_call)
 					"Deleting existing random number generators");
 
     rng_.clear();
+    stream_rng_.clear();
   }
 
   // create new rngs
@@ -1153,6 +1282,9 @@ void nest::Scheduler::create_rngs_(const bool ctor_call)
       }
 
       rng_.push_back(rng);
+
+      // the key of these generators is set by get_stream_rng()
+      stream_rng_.push_back(librandom::RngPtr(new librandom::PhiloxRandomGen(librandom::RandomGen::DefaultSeed)));
     }
 
     rng_seeds_[i] = s;
@@ -1194,222 +1326,438 @@ void nest::Scheduler::create_grng_(const bool ctor_call)
 }
 
 
-void nest::Scheduler::collocate_buffers_()
+void nest::Scheduler::collocate_buffers_(thread t)
 {
-  //count number of spikes in registers
-  int num_spikes = 0;
-  int num_grid_spikes = 0;
-  int num_offgrid_spikes = 0;
-
-  std::vector<std::vector<std::vector<uint_t> > >::iterator i;
-  std::vector<std::vector<uint_t> >::iterator j;
-  for (i = spike_register_.begin(); i != spike_register_.end(); ++i)
-    for (j = i->begin(); j != i->end(); ++j)
-      num_grid_spikes += j->size();
-
-  std::vector<std::vector<std::vector<OffGridSpike> > >::iterator it;
-  std::vector<std::vector<OffGridSpike> >::iterator jt;
-  for (it = offgrid_spike_register_.begin();
-       it != offgrid_spike_register_.end(); ++it)
-    for (jt = it->begin(); jt != it->end(); ++jt)
-      num_offgrid_spikes += jt->size();
-
-  num_spikes = num_grid_spikes + num_offgrid_spikes;
-  if (!off_grid_spiking_) // on grid spiking
+  // count the spikes of this thread in each lag
+  std::vector<size_t>::iterator first = spike_register_pos_.begin() + t * min_delay_;
+  std::fill(first, first + min_delay_, 0);
+  std::vector<RegisteredSpike>::const_iterator s;
+  for (s = spike_register_[t].begin(); s != spike_register_[t].end(); ++s)
+    ++first[s->lag];
+
+  // wait until all threads have counted their spikes
+#pragma omp barrier
+
+#pragma omp single
   {
+    // turn counts into positions, leaving room for a marker after each lag
+    size_t num_entries = 0;
+    for (std::vector<size_t>::iterator it = spike_register_pos_.begin(); it != spike_register_pos_.end(); ++it)
+    {
+      const size_t num_spikes = *it;
+      *it = num_entries;
+      num_entries += num_spikes + 1;
+    }
+
     // make sure buffers are correctly sized
-    if (global_grid_spikes_.size() != static_cast<uint_t>(Communicator::get_recv_buffer_size()))
-      global_grid_spikes_.resize(Communicator::get_recv_buffer_size(), 0);
-
-    if (num_spikes + (n_threads_ * min_delay_) > static_cast<uint_t>(Communicator::get_send_buffer_size()))
-      local_grid_spikes_.resize((num_spikes + (min_delay_ * n_threads_)), 0);
-    else if (local_grid_spikes_.size() < static_cast<uint_t>(Communicator::get_send_buffer_size()))
-      local_grid_spikes_.resize(Communicator::get_send_buffer_size(), 0);
-
-    // collocate the entries of spike_registers into local_grid_spikes__
-    std::vector<uint_t>::iterator pos = local_grid_spikes_.begin();
-    if (num_offgrid_spikes == 0)
-      for (i = spike_register_.begin(); i != spike_register_.end(); ++i)
-        for (j = i->begin(); j != i->end(); ++j)
-        {
-          pos = std::copy(j->begin(), j->end(), pos);
-          *pos = comm_marker_;
-          ++pos;
-        }
-    else
+    const size_t send_buffer_size = Communicator::get_send_buffer_size();
+    const size_t recv_buffer_size = Communicator::get_recv_buffer_size();
+    if (!off_grid_spiking_) // on grid spiking
     {
-      std::vector<OffGridSpike>::iterator n;
-      it = offgrid_spike_register_.begin();
-      for (i = spike_register_.begin(); i != spike_register_.end(); ++i)
-      {
-        jt = it->begin();
-        for (j = i->begin(); j != i->end(); ++j)
-        {
-          pos = std::copy(j->begin(), j->end(), pos);
-          for (n = jt->begin(); n != jt->end(); ++n)
-          {
-            *pos = n->get_gid();
-            ++pos;
-          }
-          *pos = comm_marker_;
-          ++pos;
-          ++jt;
-        }
-        ++it;
-      }
-      for (it = offgrid_spike_register_.begin(); it != offgrid_spike_register_.end(); ++it)
-        for (jt = it->begin(); jt != it->end(); ++jt)
-          jt->clear();
+      if (global_grid_spikes_.size() != recv_buffer_size)
+        global_grid_spikes_.resize(recv_buffer_size, 0);
+
+      if (num_entries > send_buffer_size)
+        local_grid_spikes_.resize(num_entries, 0);
+      else if (local_grid_spikes_.size() < send_buffer_size)
+        local_grid_spikes_.resize(send_buffer_size, 0);
     }
+    else // off_grid_spiking
+    {
+      if (global_offgrid_spikes_.size() != recv_buffer_size)
+        global_offgrid_spikes_.resize(recv_buffer_size, OffGridSpike(0, 0.0));
 
-    // remove old spikes from the spike_register_
-    for (i = spike_register_.begin(); i != spike_register_.end(); ++i)
-      for (j = i->begin(); j != i->end(); ++j)
-        j->clear();
+      if (num_entries > send_buffer_size)
+        local_offgrid_spikes_.resize(num_entries, OffGridSpike(0, 0.0));
+      else if (local_offgrid_spikes_.size() < send_buffer_size)
+        local_offgrid_spikes_.resize(send_buffer_size, OffGridSpike(0, 0.0));
+    }
   }
-  else // off_grid_spiking
+  // end of single section, positions and buffers are ready
+
+  if (off_grid_spiking_)
+    collocate_spike_register_(t, local_offgrid_spikes_);
+  else
+    collocate_spike_register_(t, local_grid_spikes_);
+}
+
+template <typename SpikeT>
+void nest::Scheduler::collocate_spike_register_(thread t, std::vector<SpikeT>& send_buffer)
+{
+  std::vector<size_t>::iterator pos = spike_register_pos_.begin() + t * min_delay_;
+  std::vector<RegisteredSpike>::const_iterator s;
+  for (s = spike_register_[t].begin(); s != spike_register_[t].end(); ++s)
+    make_spike_(s->gid, s->offset, send_buffer[pos[s->lag]++]);
+
+  for (delay lag = 0; lag < min_delay_; ++lag)
+    make_spike_(static_cast<uint_t>(comm_marker_), 0.0, send_buffer[pos[lag]]);
+
+  spike_register_[t].clear();
+}
+
+template <typename SpikeT>
+void nest::Scheduler::collocate_buffers_alltoallv_(std::vector<SpikeT>& send_buffer)
+{
+  const int num_processes = Communicator::get_num_processes();
+  std::vector<RegisteredSpike>::const_iterator s;
+
+  // each block carries one marker per thread and lag, plus each spike
+  // of a source with targets on the receiving rank
+  send_counts_.assign(num_processes, n_threads_ * min_delay_);
+  for (size_t t = 0; t < spike_register_.size(); ++t)
+    for (s = spike_register_[t].begin(); s != spike_register_[t].end(); ++s)
+    {
+      const size_t idx = s->gid / n_sim_procs_;
+      if (idx + 1 < remote_target_offsets_.size())
+        for (size_t k = remote_target_offsets_[idx]; k < remote_target_offsets_[idx+1]; ++k)
+          ++send_counts_[remote_target_ranks_[k]];
+    }
+
+  std::vector<int> pos(num_processes, 0);
+  for (int pid = 1; pid < num_processes; ++pid)
+    pos[pid] = pos[pid-1] + send_counts_[pid-1];
+  send_buffer.resize(pos[num_processes-1] + send_counts_[num_processes-1]);
+
+  SpikeT marker;
+  make_spike_(static_cast<uint_t>(comm_marker_), 0.0, marker);
+
+  std::vector<RegisteredSpike> by_lag;
+  std::vector<size_t> lag_begin(min_delay_ + 1);
+  for (size_t t = 0; t < spike_register_.size(); ++t)
   {
-    // make sure buffers are correctly sized 
-    if (global_offgrid_spikes_.size() != static_cast<uint_t>(Communicator::get_recv_buffer_size()))
-      global_offgrid_spikes_.resize(Communicator::get_recv_buffer_size(), OffGridSpike(0, 0.0));
-
-    if (num_spikes + (n_threads_ * min_delay_) > static_cast<uint_t>(Communicator::get_send_buffer_size()))
-      local_offgrid_spikes_.resize((num_spikes + (min_delay_ * n_threads_)), OffGridSpike(0, 0.0));
-    else if (local_offgrid_spikes_.size() < static_cast<uint_t>(Communicator::get_send_buffer_size()))
-      local_offgrid_spikes_.resize(Communicator::get_send_buffer_size(), OffGridSpike(0, 0.0));
-
-    // collocate the entries of spike_registers into local_offgrid_spikes__
-    std::vector<OffGridSpike>::iterator pos = local_offgrid_spikes_.begin();
-    if (num_grid_spikes == 0)
-      for (it = offgrid_spike_register_.begin(); it != offgrid_spike_register_.end(); ++it)
-        for (jt = it->begin(); jt != it->end(); ++jt)
-        {
-          pos = std::copy(jt->begin(), jt->end(), pos);
-          pos->set_gid(comm_marker_);
-          ++pos;
-        }
-    else
+    // sort the spikes of this thread by lag
+    std::fill(lag_begin.begin(), lag_begin.end(), 0);
+    for (s = spike_register_[t].begin(); s != spike_register_[t].end(); ++s)
+      ++lag_begin[s->lag + 1];
+    for (delay lag = 0; lag < min_delay_; ++lag)
+      lag_begin[lag + 1] += lag_begin[lag];
+
+    by_lag.resize(spike_register_[t].size(), RegisteredSpike(0, 0, 0.0));
+    std::vector<size_t> next(lag_begin.begin(), lag_begin.end() - 1);
+    for (s = spike_register_[t].begin(); s != spike_register_[t].end(); ++s)
+      by_lag[next[s->lag]++] = *s;
+
+    for (delay lag = 0; lag < min_delay_; ++lag)
     {
-      std::vector<uint_t>::iterator n;
-      i = spike_register_.begin();
-      for (it = offgrid_spike_register_.begin(); it != offgrid_spike_register_.end(); ++it)
+      for (size_t j = lag_begin[lag]; j < lag_begin[lag + 1]; ++j)
       {
-        j = i->begin();
-        for (jt = it->begin(); jt != it->end(); ++jt)
-        {
-          pos = std::copy(jt->begin(), jt->end(), pos);
-          for (n = j->begin(); n != j->end(); ++n)
-          {
-            *pos = OffGridSpike(*n,0);
-            ++pos;
-          }
-          pos->set_gid(comm_marker_);
-          ++pos;
-          ++j;
-        }
-        ++i;
+        const size_t idx = by_lag[j].gid / n_sim_procs_;
+        if (idx + 1 < remote_target_offsets_.size())
+          for (size_t k = remote_target_offsets_[idx]; k < remote_target_offsets_[idx+1]; ++k)
+            make_spike_(by_lag[j].gid, by_lag[j].offset, send_buffer[pos[remote_target_ranks_[k]]++]);
       }
-      for (i = spike_register_.begin(); i != spike_register_.end(); ++i)
-        for (j = i->begin(); j != i->end(); ++j)
-          j->clear();
+      for (int pid = 0; pid < num_processes; ++pid)
+        send_buffer[pos[pid]++] = marker;
     }
 
-    //empty offgrid_spike_register_
-    for (it = offgrid_spike_register_.begin(); it != offgrid_spike_register_.end(); ++it)
-      for (jt = it->begin(); jt != it->end(); ++jt)
-        jt->clear();
+    spike_register_[t].clear();
   }
 }
 
-void nest::Scheduler::deliver_events_(thread t)
+void nest::Scheduler::update_remote_targets_()
 {
-  // deliver only at beginning of time slice
-  if (from_step_ > 0)
+  // all ranks have to take part in the exchange if connectivity
+  // changed on any of them
+  std::vector<int_t> rebuild(Communicator::get_num_processes(), 0);
+  rebuild[Communicator::get_rank()] = remote_targets_valid_ ? 0 : 1;
+  Communicator::communicate(rebuild);
+  if (std::find(rebuild.begin(), rebuild.end(), 1) == rebuild.end())
     return;
 
-  size_t n_markers = 0;
-  SpikeEvent se;
+  const int num_processes = Communicator::get_num_processes();
+
+  // sort sources with local targets by the rank they live on
+  std::vector<index> sources;
+  net_->connection_manager_.get_sources_with_local_targets(sources);
+
+  std::vector<int> send_counts(num_processes, 0);
+  for (std::vector<index>::const_iterator it = sources.begin(); it != sources.end(); ++it)
+    ++send_counts[get_process_id(suggest_vp(*it))];
 
-  std::vector<int> pos(displacements_);
+  std::vector<int> pos(num_processes, 0);
+  for (int pid = 1; pid < num_processes; ++pid)
+    pos[pid] = pos[pid-1] + send_counts[pid-1];
 
-  if (!off_grid_spiking_) //on_grid_spiking
+  std::vector<uint_t> send_buffer(sources.size());
+  for (std::vector<index>::const_iterator it = sources.begin(); it != sources.end(); ++it)
+    send_buffer[pos[get_process_id(suggest_vp(*it))]++] = *it;
+
+  std::vector<uint_t> recv_buffer;
+  std::vector<int> displacements;
+  Communicator::communicate_Alltoallv(send_buffer, send_counts, recv_buffer, displacements);
+
+  // build compressed lists of requesting ranks for each local source
+  remote_target_offsets_.assign(net_->size() / n_sim_procs_ + 2, 0);
+  for (std::vector<uint_t>::const_iterator it = recv_buffer.begin(); it != recv_buffer.end(); ++it)
   {
-    // prepare Time objects for every possible time stamp within min_delay_
-    std::vector<Time> prepared_timestamps(min_delay_);
-    for (size_t lag=0; lag < (size_t) min_delay_; lag++)
+    assert(get_process_id(suggest_vp(*it)) == Communicator::get_rank());
+    ++remote_target_offsets_[*it / n_sim_procs_ + 1];
+  }
+  for (size_t idx = 1; idx < remote_target_offsets_.size(); ++idx)
+    remote_target_offsets_[idx] += remote_target_offsets_[idx-1];
+
+  remote_target_ranks_.resize(remote_target_offsets_.back());
+  std::vector<size_t> next(remote_target_offsets_.begin(), remote_target_offsets_.end() - 1);
+  for (size_t pid = 0; pid < displacements.size(); ++pid)
+  {
+    const size_t end = pid + 1 < displacements.size() ? displacements[pid+1] : recv_buffer.size();
+    for (size_t k = displacements[pid]; k < end; ++k)
+      remote_target_ranks_[next[recv_buffer[k] / n_sim_procs_]++] = pid;
+  }
+
+  remote_targets_valid_ = true;
+}
+
+void nest::Scheduler::update_thread_targets_()
+{
+  const index n_gids = net_->size();
+  if ( thread_targets_valid_ and has_targets_on_thread_.size() == n_gids * n_threads_ )
+    return;
+
+  has_targets_on_thread_.assign(n_gids * n_threads_, false);
+  for (index gid = 1; gid < n_gids; ++gid)
+    for (thread t = 0; t < static_cast<thread>(n_threads_); ++t)
+      if ( net_->connection_manager_.has_targets(t, gid) )
+        has_targets_on_thread_[gid * n_threads_ + t] = true;
+
+  received_spikes_.clear();
+  received_spikes_.resize(n_threads_, std::vector<std::vector<ReceivedSpike> >(n_threads_));
+  partition_markers_.assign(n_threads_, 0);
+  partition_chunk_start_.assign(n_threads_, 0);
+  sorted_spikes_.clear();
+  sorted_spikes_.resize(n_threads_);
+  sort_buffer_.clear();
+  sort_buffer_.resize(n_threads_);
+
+  thread_targets_valid_ = true;
+}
+
+template <typename SpikeT>
+void nest::Scheduler::partition_received_spikes_(const std::vector<SpikeT>& recv_buffer, thread t)
+{
+  for (size_t target_t = 0; target_t < received_spikes_[t].size(); ++target_t)
+    received_spikes_[t][target_t].clear();
+
+  // The chunk of each rank starts at displacements_[pid] and holds
+  // min_delay_ lags for each thread of the sending rank, each lag
+  // terminated by a marker. Entries after the last marker are unused.
+  // Each thread handles an equal range of the buffer, so that the work
+  // is balanced also for fewer ranks than threads.
+  const size_t n = recv_buffer.size();
+  const size_t begin = n * t / n_threads_;
+  const size_t end = n * (t + 1) / n_threads_;
+  const size_t n_pids = displacements_.size();
+  const size_t markers_per_chunk = n_threads_ * min_delay_;
+
+  // chunk containing begin
+  const size_t first_pid = std::upper_bound(displacements_.begin(), displacements_.end(),
+                                            static_cast<int>(begin)) - displacements_.begin() - 1;
+
+  // count markers in range after the last chunk start
+  size_t n_markers = 0;
+  bool chunk_start = static_cast<size_t>(displacements_[first_pid]) == begin;
+  size_t next_pid = first_pid + 1;
+  for (size_t pos = begin; pos < end; ++pos)
+  {
+    for ( ; next_pid < n_pids && static_cast<size_t>(displacements_[next_pid]) == pos; ++next_pid)
     {
-      prepared_timestamps[lag] = clock_ - Time::step(lag);
+      n_markers = 0;
+      chunk_start = true;
     }
+    if (get_spike_gid_(recv_buffer[pos]) == static_cast<index>(comm_marker_))
+      ++n_markers;
+  }
+  partition_markers_[t] = n_markers;
+  partition_chunk_start_[t] = chunk_start;
+
+  // wait until all threads have counted their markers
+#pragma omp barrier
 
-    for (size_t vp = 0; vp < (size_t)Communicator::get_num_virtual_processes(); ++vp)
+  // markers preceding begin in its chunk determine the lag of the first entry
+  n_markers = 0;
+  if (static_cast<size_t>(displacements_[first_pid]) != begin)
+    for (thread u = t - 1; u >= 0; --u)
+    {
+      n_markers += partition_markers_[u];
+      if (partition_chunk_start_[u])
+        break;
+    }
+
+  delay lag = min_delay_ - 1 - n_markers % min_delay_;
+  next_pid = first_pid + 1;
+  for (size_t pos = begin; pos < end; ++pos)
+  {
+    for ( ; next_pid < n_pids && static_cast<size_t>(displacements_[next_pid]) == pos; ++next_pid)
     {
-      size_t pid = get_process_id(vp);
-      int lag = min_delay_ - 1;
-      while (n_markers < (size_t) min_delay_)
-      {
-        index nid = global_grid_spikes_[pos[pid]];
-        if (nid != static_cast<index>(comm_marker_))
-        {
-          // tell all local nodes about spikes on remote machines.
-          se.set_stamp(prepared_timestamps[lag]);
-          se.set_sender_gid(nid);
-          net_->connection_manager_.send(t, nid, se);
-        }
-        else
-        {
-          ++n_markers;
-          --lag;
-        }
-        ++pos[pid];
-      }
       n_markers = 0;
+      lag = min_delay_ - 1;
+    }
+    if (n_markers >= markers_per_chunk)
+      continue;  // unused rest of chunk
+
+    const index nid = get_spike_gid_(recv_buffer[pos]);
+    if (nid != static_cast<index>(comm_marker_))
+    {
+      if ( nid * n_threads_ < has_targets_on_thread_.size() )
+        for (size_t target_t = 0; target_t < n_threads_; ++target_t)
+          if ( has_targets_on_thread_[nid * n_threads_ + target_t] )
+            received_spikes_[t][target_t].push_back(
+              ReceivedSpike(nid, lag, get_spike_offset_(recv_buffer[pos])));
+    }
+    else
+    {
+      ++n_markers;
+      lag = lag == 0 ? min_delay_ - 1 : lag - 1;
     }
   }
-  else //off grid spiking
+}
+
+void nest::Scheduler::deliver_events_(thread t)
+{
+  // deliver only at beginning of time slice
+  if (from_step_ > 0)
+    return;
+
+  if (off_grid_spiking_)
+    partition_received_spikes_(global_offgrid_spikes_, t);
+  else
+    partition_received_spikes_(global_grid_spikes_, t);
+
+  // wait until all received spikes are partitioned
+#pragma omp barrier
+
+  // prepare Time objects for every possible time stamp within min_delay_
+  std::vector<Time> prepared_timestamps(min_delay_);
+  for (size_t lag=0; lag < (size_t) min_delay_; lag++)
+  {
+    prepared_timestamps[lag] = clock_ - Time::step(lag);
+  }
+
+  delivery_timers_[t].start();
+
+  SpikeEvent se;
+  std::vector<ReceivedSpike>::const_iterator s;
+  if (sort_spikes_by_source_)
   {
-    // prepare Time objects for every possible time stamp within min_delay_
-    std::vector<Time> prepared_timestamps(min_delay_);
-    for (size_t lag=0; lag < (size_t) min_delay_; lag++)
+    sort_received_spikes_(t);
+
+    // spikes from the same source are adjacent, so their connector
+    // only has to be looked up once
+    index last_gid = 0;
+    ConnectorBase* conn = 0;
+    for (s = sorted_spikes_[t].begin(); s != sorted_spikes_[t].end(); ++s)
     {
-      prepared_timestamps[lag] = clock_ - Time::step(lag);
+      if (s->gid != last_gid)
+      {
+        conn = net_->connection_manager_.get_connector(t, s->gid);
+        ++connector_lookups_[t];
+        last_gid = s->gid;
+      }
+      if (conn == 0)
+        continue;
+
+      se.set_stamp(prepared_timestamps[s->lag]);
+      se.set_sender_gid(s->gid);
+      if (off_grid_spiking_)
+        se.set_offset(s->offset);
+      net_->connection_manager_.send(t, conn, se);
     }
-
-    for (size_t vp = 0; vp < (size_t)Communicator::get_num_virtual_processes(); ++vp)
+  }
+  else
+    for (size_t source_t = 0; source_t < received_spikes_.size(); ++source_t)
     {
-      size_t pid = get_process_id(vp);
-      int lag = min_delay_ - 1;
-      while (n_markers < (size_t) min_delay_)
+      connector_lookups_[t] += received_spikes_[source_t][t].size();
+      for (s = received_spikes_[source_t][t].begin(); s != received_spikes_[source_t][t].end(); ++s)
       {
-        index nid = global_offgrid_spikes_[pos[pid]].get_gid();
-        if (nid != static_cast<index>(comm_marker_))
-        {
-          // tell all local nodes about spikes on remote machines.
-          se.set_stamp(prepared_timestamps[lag]);
-          se.set_sender_gid(nid);
-          se.set_offset(global_offgrid_spikes_[pos[pid]].get_offset());
-          net_->connection_manager_.send(t, nid, se);
-        }
-        else
-        {
-          ++n_markers;
-          --lag;
-        }
-        ++pos[pid];
+        // tell all local nodes about spikes on remote machines.
+        se.set_stamp(prepared_timestamps[s->lag]);
+        se.set_sender_gid(s->gid);
+        if (off_grid_spiking_)
+          se.set_offset(s->offset);
+        net_->connection_manager_.send(t, s->gid, se);
       }
-      n_markers = 0;
     }
+
+  delivery_timers_[t].stop();
+}
+
+void nest::Scheduler::sort_received_spikes_(thread t)
+{
+  std::vector<ReceivedSpike>& spikes = sorted_spikes_[t];
+  std::vector<ReceivedSpike>& buffer = sort_buffer_[t];
+
+  spikes.clear();
+  for (size_t source_t = 0; source_t < received_spikes_.size(); ++source_t)
+    spikes.insert(spikes.end(), received_spikes_[source_t][t].begin(), received_spikes_[source_t][t].end());
+
+  uint_t max_gid = 0;
+  for (std::vector<ReceivedSpike>::const_iterator s = spikes.begin(); s != spikes.end(); ++s)
+    max_gid = std::max(max_gid, s->gid);
+  buffer.resize(spikes.size(), ReceivedSpike(0, 0, 0.0));
+
+  // least significant digit radix sort, one byte of the GID per pass
+  const size_t radix_bits = 8;
+  const uint_t digit_mask = (1 << radix_bits) - 1;
+  std::vector<size_t> pos(digit_mask + 2);
+  for (size_t shift = 0; shift < 8 * sizeof(uint_t) && (max_gid >> shift) > 0; shift += radix_bits)
+  {
+    std::fill(pos.begin(), pos.end(), 0);
+    for (std::vector<ReceivedSpike>::const_iterator s = spikes.begin(); s != spikes.end(); ++s)
+      ++pos[((s->gid >> shift) & digit_mask) + 1];
+    for (size_t d = 1; d < pos.size(); ++d)
+      pos[d] += pos[d-1];
+    for (std::vector<ReceivedSpike>::const_iterator s = spikes.begin(); s != spikes.end(); ++s)
+      buffer[pos[(s->gid >> shift) & digit_mask]++] = *s;
+    spikes.swap(buffer);
   }
 }
 
 void nest::Scheduler::gather_events_()
 {
-  collocate_buffers_();
+  if (pipelined_comm_ && !Communicator::get_use_Alltoallv())
+  {
+    if (off_grid_spiking_)
+      Communicator::start_communicate(local_offgrid_spikes_, global_offgrid_spikes_);
+    else
+      Communicator::start_communicate(local_grid_spikes_, global_grid_spikes_);
+    comm_in_flight_ = true;
+    comm_hidden_timer_.start();
+    return;
+  }
+
+  if (Communicator::get_use_Alltoallv())
+  {
+    assert(remote_targets_valid_);
+    if (off_grid_spiking_)
+    {
+      collocate_buffers_alltoallv_(local_offgrid_spikes_);
+      Communicator::communicate_Alltoallv(local_offgrid_spikes_, send_counts_, global_offgrid_spikes_, displacements_);
+    }
+    else
+    {
+      collocate_buffers_alltoallv_(local_grid_spikes_);
+      Communicator::communicate_Alltoallv(local_grid_spikes_, send_counts_, global_grid_spikes_, displacements_);
+    }
+    return;
+  }
+
   if (off_grid_spiking_)
     Communicator::communicate(local_offgrid_spikes_, global_offgrid_spikes_, displacements_);
   else
     Communicator::communicate(local_grid_spikes_, global_grid_spikes_, displacements_);
 }
 
+void nest::Scheduler::finish_gather_events_()
+{
+  comm_hidden_timer_.stop();
+  comm_wait_timer_.start();
+  if (off_grid_spiking_)
+    Communicator::finish_communicate(local_offgrid_spikes_, global_offgrid_spikes_, displacements_);
+  else
+    Communicator::finish_communicate(local_grid_spikes_, global_grid_spikes_, displacements_);
+  comm_wait_timer_.stop();
+}
+
 void nest::Scheduler::advance_time_()
 {
   // time now advanced time by the duration of the previous step
@@ -36,8 +36,11 @@
 #include "event.h"
 #include "event_priority.h"
 #include "randomgen.h"
+#include "philox.h"
 #include "lockptr.h"
+#include "sliexceptions.h"
 #include "communicator.h"
+#include "stopwatch.h"
 
 namespace nest
 {
@@ -300,6 +303,23 @@ namespace nest
      */
     librandom::RngPtr get_grng() const;
 
+    /**
+     * Return pointer to random number generator for drawing numbers
+     * that concern the given source and target. If vp_independent_rng
+     * is set, this is a counter-based generator of the specified thread,
+     * set to the beginning of the stream (grng_seed, source, target,
+     * purpose), so that the numbers do not depend on the number of
+     * virtual processes. Otherwise, it is get_rng(thrd).
+     */
+    librandom::RngPtr get_stream_rng(const thread, index, index, ulong_t) const;
+
+    /**
+     * Return a purpose for get_stream_rng() not returned before. All
+     * processes must call it in the same order, e.g., once per Connect
+     * call, so that the purposes agree for all numbers of processes.
+     */
+    ulong_t new_rng_purpose();
+
     /**
      * Return (T+d) mod max_delay.
      */
@@ -427,6 +447,27 @@ namespace nest
     bool off_grid_spiking_; //!< indicates whether spikes are not constrained to the grid 
     bool print_time_;       //!< Indicates whether time should be printed during simulations (or not)
 
+    bool pipelined_comm_;   //!< Overlap spike exchange with the update of nodes without incoming connections
+    bool comm_in_flight_;   //!< Spike exchange for the previous slice has been started, but not completed
+    Stopwatch comm_hidden_timer_; //!< Time spent updating nodes while spikes were exchanged
+    Stopwatch comm_wait_timer_;   //!< Time spent waiting for the completion of pipelined spike exchange
+
+    bool population_update_;      //!< Update runs of nodes of one model with Node::update_population()
+
+    bool sort_spikes_by_source_;  //!< Deliver received spikes in order of their source GID
+    bool vp_independent_rng_;     //!< Draw from counter-based streams in get_stream_rng()
+    ulong_t rng_purposes_;        //!< Number of purposes returned by new_rng_purpose()
+    std::vector<unsigned long> connector_lookups_; //!< Number of connector lookups by each thread
+    std::vector<Stopwatch> delivery_timers_;       //!< Time spent delivering received spikes by each thread
+
+    /**
+     * Nodes on each thread without incoming connections, which do not
+     * depend on spikes delivered at the beginning of a slice, and all
+     * other nodes. Only used with pipelined communication.
+     */
+    vector<vector<Node*> > independent_nodes_vec_;
+    vector<vector<Node*> > dependent_nodes_vec_;
+
     std::vector<long_t> rng_seeds_;  //!< The seeds of the local RNGs. These do not neccessarily describe the state of the RNGs.
     long_t grng_seed_;   //!< The seed of the global RNG, not neccessarily describing the state of the GRNG.
     
@@ -484,30 +525,43 @@ namespace nest
      * There must be PRECISELY one rng per thread.
      */
     vector<librandom::RngPtr> rng_;
+    /**
+     * Counter-based random number generators for get_stream_rng(),
+     * one per thread.
+     */
+    vector<librandom::RngPtr> stream_rng_;
     /**
      * Global random number generator.
      * This rng must be synchronized on all threads
      */
     librandom::RngPtr grng_;
 
-    /** 
-     * Register for gids of neurons that spiked. This is a 3-dim
-     * structure.
-     * - First dim: Each thread has its own vector to write to.
-     * - Second dim: A vector for each slice of the min_delay interval
-     * - Third dim: The gids.
+    /**
+     * Spike of a local neuron, registered for sending to remote machines.
+     * Spikes on the grid have offset 0.
      */
-    std::vector<std::vector<std::vector<uint_t> > > spike_register_;
+    struct RegisteredSpike
+    {
+      RegisteredSpike(uint_t g, uint_t l, double_t o) : gid(g), lag(l), offset(o) {}
+      uint_t gid;
+      uint_t lag;
+      double_t offset;
+    };
 
-    /** 
-     * Register for off-grid spikes.
-     * This is a 3-dim structure.
-     * - First dim: Each thread has its own vector to write to.
-     * - Second dim: A vector for each slice of the min_delay interval
-     * - Third dim: Struct containing GID and offset.
+    /**
+     * Register for spikes of local neurons. Each thread appends on-grid
+     * and off-grid spikes of all lags to its own contiguous vector.
+     * The spikes are sorted by lag only when they are collocated into
+     * the send buffer.
      */
-    std::vector<std::vector<std::vector<OffGridSpike> > > 
-      offgrid_spike_register_;
+    std::vector<std::vector<RegisteredSpike> > spike_register_;
+
+    /**
+     * Position in the send buffer of the spikes of thread t and lag,
+     * at index t * min_delay_ + lag. Filled with the number of spikes
+     * and turned into positions by a prefix sum during collocation.
+     */
+    std::vector<size_t> spike_register_pos_;
 
     /**
      * Buffer containing the gids of local neurons that spiked in the 
@@ -542,6 +596,67 @@ namespace nest
      * each process within the global_(off)grid_spikes_ buffer.
      */
      std::vector<int> displacements_;
+
+    /**
+     * Ranks holding targets of local sources, in compressed row format.
+     * The ranks for the local source with GID g are stored in
+     * remote_target_ranks_[remote_target_offsets_[i]] to
+     * remote_target_ranks_[remote_target_offsets_[i+1]-1], with
+     * i = g / n_sim_procs_, ordered by rank. Only used if spikes are
+     * exchanged via Alltoallv.
+     */
+    std::vector<size_t> remote_target_offsets_;
+    std::vector<int> remote_target_ranks_;
+    bool remote_targets_valid_; //!< false if connectivity changed since remote targets were built
+
+    /**
+     * Bitmap marking sources with targets on a given thread. Bit
+     * gid * n_threads_ + t is set if node gid has targets on thread t.
+     */
+    std::vector<bool> has_targets_on_thread_;
+    bool thread_targets_valid_; //!< false if connectivity changed since has_targets_on_thread_ was built
+
+    /**
+     * Spike received from any process, stored for delivery by one thread.
+     */
+    struct ReceivedSpike
+    {
+      ReceivedSpike(uint_t g, delay l, double_t o) : gid(g), lag(l), offset(o) {}
+      uint_t gid;
+      delay lag;
+      double_t offset;
+    };
+
+    /**
+     * Received spikes partitioned by the thread delivering them.
+     * - First dim: The thread that partitioned the spikes.
+     * - Second dim: The thread that delivers the spikes.
+     * - Third dim: The spikes, in order of arrival.
+     */
+    std::vector<std::vector<std::vector<ReceivedSpike> > > received_spikes_;
+
+    /**
+     * For each thread partitioning received spikes, the number of
+     * markers in its range of the receive buffer after the last start
+     * of a rank's chunk within the range, and whether the range
+     * contains such a start.
+     */
+    std::vector<size_t> partition_markers_;
+    std::vector<int> partition_chunk_start_;
+
+    /**
+     * Received spikes to be delivered by each thread, sorted by source
+     * GID, and scratch space for sorting them. Only used if
+     * sort_spikes_by_source_ is set.
+     */
+    std::vector<std::vector<ReceivedSpike> > sorted_spikes_;
+    std::vector<std::vector<ReceivedSpike> > sort_buffer_;
+
+    /**
+     * Number of entries sent to each rank if spikes are exchanged
+     * via Alltoallv.
+     */
+    std::vector<int> send_counts_;
           
 
     /**
@@ -571,17 +686,88 @@ namespace nest
     void update_nodes_vec_();
 
     /**
-     * Rearrange the spike_register into a 2-dim structure. This is
-     * done by collecting the spikes from all threads in each slice of
-     * the min_delay_ interval.
+     * Copy the spikes registered by thread t into the send buffer,
+     * sorted by lag, with a marker after each lag. Must be called by
+     * all threads, which first count their spikes per lag and then
+     * write to disjoint ranges of the send buffer, whose positions
+     * are determined by a prefix sum over threads and lags.
+     */
+    void collocate_buffers_(thread t);
+
+    /**
+     * Copy the spikes registered by thread t into send_buffer.
+     */
+    template <typename SpikeT>
+    void collocate_spike_register_(thread t, std::vector<SpikeT>& send_buffer);
+
+    /**
+     * Collocate the spike register into one block per receiving rank,
+     * containing only spikes from sources with targets on that rank.
+     * Each block has the same layout as the send buffer built by
+     * collocate_buffers_(), so that deliver_events_() can read the
+     * received buffer unchanged.
+     */
+    template <typename SpikeT>
+    void collocate_buffers_alltoallv_(std::vector<SpikeT>& send_buffer);
+
+    /**
+     * Determine, for each local source, the ranks holding its targets.
+     * Every rank sends the GIDs of all sources with local targets to the
+     * ranks owning these sources. Must be called on all ranks, does
+     * nothing if connectivity did not change anywhere.
+     */
+    void update_remote_targets_();
+
+    /**
+     * Rebuild has_targets_on_thread_ if connectivity changed.
+     */
+    void update_thread_targets_();
+
+    /**
+     * Split the spikes in the t-th of n_threads_ equal ranges of the
+     * receive buffer into lists for each thread with targets of the
+     * sender, so that threads only visit spikes they have to deliver.
+     * Must be called by all threads, as it synchronizes them once.
+     */
+    template <typename SpikeT>
+    void partition_received_spikes_(const std::vector<SpikeT>& recv_buffer, thread t);
+
+    /**
+     * Merge the spikes to be delivered by thread t into sorted_spikes_[t]
+     * and radix sort them by source GID. Spikes from the same source
+     * keep their order.
      */
-    void collocate_buffers_();
+    void sort_received_spikes_(thread t);
 
     /**
-     * Collocate buffers and exchange events with other MPI processes.
+     * Exchange events with other MPI processes. Except for Alltoallv
+     * communication, the send buffer must have been collocated by
+     * collocate_buffers_() before. With pipelined communication, the
+     * exchange is only started here and completed by
+     * finish_gather_events_().
      */
     void gather_events_();
 
+    /**
+     * Wait for the completion of a spike exchange started by
+     * gather_events_().
+     */
+    void finish_gather_events_();
+
+    /**
+     * Split the nodes on each thread into those with and without
+     * incoming connections, for pipelined communication.
+     */
+    void update_independent_nodes_();
+
+    /**
+     * Update the given nodes from from_step_ to to_step_. Exceptions
+     * are stored in exceptions_raised, since this is called in a
+     * parallel region.
+     */
+    void update_nodes_(const vector<Node*>& nodes, thread t,
+                       vector<lockPTR<WrappedThreadException> >& exceptions_raised);
+
     /**
      * Read all event buffers for thread t and send the corresponding
      * Events to the Nodes that are targeted.
@@ -590,6 +776,9 @@ namespace nest
      * are delivered ordered by non-decreasing time stamps. BUT: this 
      * ordering applies to time stamps only, it does NOT take into 
      * account the offsets of precise spikes.
+     *
+     * Must be called by all threads, since it synchronizes them after
+     * partitioning the received spikes.
      */
     void deliver_events_(thread t);
   };
@@ -743,6 +932,25 @@ namespace nest
     return grng_;
   }
 
+  inline
+  librandom::RngPtr Scheduler::get_stream_rng(const thread thrd, index source,
+					      index target, ulong_t purpose) const
+  {
+    if ( not vp_independent_rng_ )
+      return get_rng(thrd);
+
+    assert(thrd < static_cast<thread>(stream_rng_.size()));
+    librandom::RngPtr rng = stream_rng_[thrd];
+    static_cast<librandom::PhiloxRandomGen&>(*rng).set_stream(grng_seed_, source, target, purpose);
+    return rng;
+  }
+
+  inline
+  ulong_t Scheduler::new_rng_purpose()
+  {
+    return rng_purposes_++;
+  }
+
   inline 
   void Scheduler::calibrate_clock()
   {
@@ -768,17 +976,18 @@ namespace nest
   void Scheduler::send_remote(thread t, SpikeEvent& e, const delay lag)
   {
     // Put the spike in a buffer for the remote machines
+    const RegisteredSpike rs(e.get_sender().get_gid(), lag, 0.0);
     for (int_t i = 0; i < e.get_multiplicity(); ++i)
-      spike_register_[t][lag].push_back(e.get_sender().get_gid());
+      spike_register_[t].push_back(rs);
   }
 
   inline
   void Scheduler::send_offgrid_remote(thread t, SpikeEvent& e, const delay lag)
   {
     // Put the spike in a buffer for the remote machines
-    OffGridSpike ogs(e.get_sender().get_gid(), e.get_offset());
+    const RegisteredSpike rs(e.get_sender().get_gid(), lag, e.get_offset());
     for (int_t i = 0; i < e.get_multiplicity(); ++i)
-      offgrid_spike_register_[t][lag].push_back(ogs);
+      spike_register_[t].push_back(rs);
   }
 
   inline
@@ -36,10 +36,10 @@ nest::SparseNodeArray::SparseNodeArray()
     max_gid_(0),
     local_min_gid_(0),
     local_max_gid_(0),
-    gid_idx_scale_(1.0)
-{
-  step_ctr_[0] = 0;
-}
+    gid_idx_scale_(1.0),
+    gid_stride_(0),
+    regular_max_gid_(0)
+{}
 
 void nest::SparseNodeArray::reserve(size_t new_size)
 {
@@ -65,6 +65,22 @@ void nest::SparseNodeArray::add_local_node(Node& node)
   // gid must exceed max_gid_, except if gid is root
   assert(gid > max_gid_ || ( gid == 0 && max_gid_ == 0 ));
 
+  // extend regular prefix if gid continues the arithmetic progression
+  // of local gids; the prefix ends for good at the first irregular gid
+  if ( gid > 0 )
+  {
+    if ( local_min_gid_ == 0 )
+      regular_max_gid_ = gid;
+    else if ( regular_max_gid_ == local_max_gid_ )
+    {
+      const index step = gid - local_max_gid_;
+      if ( gid_stride_ == 0 )
+        gid_stride_ = step;
+      if ( step == gid_stride_ )
+        regular_max_gid_ = gid;
+    }
+  }
+
   // all is consistent, register node and update auxiliary variables
   nodes_.push_back(NodeEntry_(node, gid));
   if ( local_min_gid_ == 0 )  // only first non-zero
@@ -112,7 +128,21 @@ nest::Node* nest::SparseNodeArray::get_node_by_gid(index gid) const
     return 0;
   }
 
-  // now estimate index
+  // compute index directly within regular prefix
+  if ( gid <= regular_max_gid_ )
+  {
+    const index offset = gid - local_min_gid_;
+    if ( gid_stride_ == 0 )  // prefix consists of single node
+      return offset == 0 ? nodes_[1].node_ : 0;
+    if ( offset % gid_stride_ != 0 )
+      return 0;
+
+    const size_t idx = 1 + offset / gid_stride_;
+    assert(idx < nodes_.size() && nodes_[idx].gid_ == gid);
+    return nodes_[idx].node_;
+  }
+
+  // otherwise estimate index
   size_t idx = std::floor(1 + gid_idx_scale_ * ( gid - local_min_gid_ ));
   assert(idx < nodes_.size());
 
@@ -25,7 +25,6 @@
 
 #include <cassert>
 #include <vector>
-#include <map>
 
 #include "nest.h"
 
@@ -44,10 +43,12 @@ namespace nest {
  *   GID  %  M  --> rank
  *   GID div M  --> index on rank
  *
- * so that the latter gives and index into the local node array. This index
+ * so that the latter gives and index into the local node array. As long as
+ * local GIDs form an arithmetic progression, i.e., for the round-robin
+ * assignment of neurons to ranks, the index is computed directly. The index
  * will be skewed due to nodes without proxies present on all ranks, whence
- * computation may give an index that is too low and we must search to the right
- * for the actual node. We never need to search to the left.
+ * beyond the regular prefix we estimate the index by interpolation and search
+ * for the actual node from there.
  */
 class SparseNodeArray
 {
@@ -121,15 +122,14 @@ public:
     */
   index get_max_gid() const;
 
-  std::map<long, size_t> get_step_ctr() const;
-
 private:
   std::vector<NodeEntry_> nodes_;   //!< stores local node information
   index                   max_gid_; //!< largest GID in network
   index                   local_min_gid_; //!< smallest local GID
   index                   local_max_gid_; //!< largest local GID
   double                  gid_idx_scale_; //!< interpolation factor
-  mutable std::map<long, size_t>  step_ctr_; //!< for analysis, measure misses
+  index                   gid_stride_; //!< GID step between local nodes in regular prefix
+  index                   regular_max_gid_; //!< largest GID in regular prefix
 };
 
 }  // namespace nest
@@ -148,7 +148,8 @@ void nest::SparseNodeArray::clear()
     local_min_gid_ = 0;
     local_max_gid_ = 0;
     gid_idx_scale_ = 1.;
-    step_ctr_.clear();
+    gid_stride_ = 0;
+    regular_max_gid_ = 0;
 }
 
 inline
@@ -170,10 +171,4 @@ nest::index nest::SparseNodeArray::get_max_gid() const
     return max_gid_;
 }
 
-inline
-std::map<long, size_t> nest::SparseNodeArray::get_step_ctr() const
-{
-    return step_ctr_;
-}
-
 #endif /* SPARSE_NODE_ARRAY_H */
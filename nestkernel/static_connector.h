@@ -0,0 +1,257 @@
+/*
+ *  static_connector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATIC_CONNECTOR_H
+#define STATIC_CONNECTOR_H
+
+#include <vector>
+
+#include "connector_base.h"
+
+namespace nest
+{
+
+  // weight policy for StaticConnector: one weight per connection
+  class IndividualWeights
+  {
+    std::vector<double_t> weights_;
+
+  public:
+
+    template < typename ConnectionT >
+    void push_back(const ConnectionT & c) { weights_.push_back(c.get_weight()); }
+
+    template < typename ConnectionT >
+    void get(size_t i, ConnectionT & c) const { c.set_weight(weights_[i]); }
+
+    template < typename ConnectionT >
+    void set(size_t i, const ConnectionT & c) { weights_[i] = c.get_weight(); }
+
+    template < typename CommonPropertiesT >
+    double_t operator()(size_t i, const CommonPropertiesT &) const { return weights_[i]; }
+
+    void reserve(size_t n) { weights_.reserve(n); }
+
+    void shrink_to_fit()
+    {
+      if (weights_.capacity() > weights_.size())
+	std::vector<double_t>(weights_).swap(weights_);
+    }
+
+    size_t get_memory() const { return weights_.capacity() * sizeof(double_t); }
+  };
+
+  // weight policy for StaticConnector: weight taken from the common properties
+  class HomogeneousWeight
+  {
+  public:
+
+    template < typename ConnectionT >
+    void push_back(const ConnectionT &) {}
+
+    template < typename ConnectionT >
+    void get(size_t, ConnectionT &) const {}
+
+    template < typename ConnectionT >
+    void set(size_t, const ConnectionT &) {}
+
+    template < typename CommonPropertiesT >
+    double_t operator()(size_t, const CommonPropertiesT & cp) const { return cp.get_weight(); }
+
+    void reserve(size_t) {}
+
+    void shrink_to_fit() {}
+
+    size_t get_memory() const { return 0; }
+  };
+
+  // homogeneous connector for static synapses containing >=K_cutoff entries
+  // stores targets, delays and weights in separate arrays instead of an
+  // array of connection objects, so that send() walks compact memory
+  // connection models use it by specializing Connector<K_cutoff, ConnectionT>
+  template < typename ConnectionT, typename targetidentifierT, typename WeightsT >
+  class StaticConnector : public vector_like<ConnectionT>
+  {
+    std::vector<targetidentifierT> targets_;
+    std::vector<unsigned int> delays_; // in steps
+    WeightsT weights_;
+    synindex syn_id_;
+
+  public:
+
+    StaticConnector(const Connector<K_cutoff-1, ConnectionT> &C, const ConnectionT &c)
+      : syn_id_(c.get_syn_id())
+    {
+      targets_.reserve(K_cutoff);
+      delays_.reserve(K_cutoff);
+      weights_.reserve(K_cutoff);
+      for (size_t i=0; i<K_cutoff-1; i++)
+	append_(C.get_C()[i]);
+      append_(c);
+    }
+
+    ~StaticConnector()
+    {}
+
+    void get_synapse_status(synindex syn_id, DictionaryDatum & d, port p) const
+    {
+      if ( syn_id == syn_id_ )
+      {
+	assert (p >= 0 && static_cast<size_t>(p) < targets_.size());
+	get_connection_(p).get_status(d);
+      }
+    }
+
+    void set_synapse_status(synindex syn_id, ConnectorModel & cm, const DictionaryDatum & d, port p)
+    {
+      if ( syn_id == syn_id_ )
+      {
+	assert (p >= 0 && static_cast<size_t>(p) < targets_.size());
+	ConnectionT c = get_connection_(p);
+	c.set_status(d, static_cast< GenericConnectorModel<ConnectionT> & > (cm));
+	delays_[p] = c.get_delay_steps();
+	weights_.set(p, c);
+      }
+    }
+
+    size_t get_num_connections()
+    {
+      return targets_.size();
+    }
+
+    size_t get_num_connections(synindex syn_id)
+    {
+      if (syn_id == syn_id_)
+	return targets_.size();
+      else
+	return 0;
+    }
+
+    StaticConnector & push_back(const ConnectionT & c)
+    {
+      append_(c);
+      return *this;
+    }
+
+    void get_connections(size_t source_gid, size_t thrd, synindex synapse_id, ArrayDatum &conns) const
+    {
+      if(syn_id_==synapse_id)
+	for ( size_t i=0; i<targets_.size(); i++ )
+	  conns.push_back(ConnectionDatum(ConnectionID(source_gid, targets_[i].get_target_ptr(thrd)->get_gid(), thrd, synapse_id, i)));
+    }
+
+    void get_connections(size_t source_gid, size_t target_gid, size_t thrd, size_t synapse_id, ArrayDatum &conns) const
+    {
+      if(syn_id_==synapse_id)
+	for ( size_t i=0; i<targets_.size(); i++ )
+	  if (targets_[i].get_target_ptr(thrd)->get_gid() == target_gid)
+	    conns.push_back(ConnectionDatum(ConnectionID(source_gid, target_gid, thrd, synapse_id, i)));
+    }
+
+    void send(Event &e, thread t, const std::vector<ConnectorModel*> & cm)
+    {
+      const typename ConnectionT::CommonPropertiesType & cp =
+	static_cast< GenericConnectorModel<ConnectionT> * > ( cm[syn_id_] )->get_common_properties();
+
+      const size_t n = targets_.size();
+      for(size_t i=0; i<n; i++)
+      {
+	e.set_port(i);
+	e.set_weight(weights_(i, cp));
+	e.set_delay(delays_[i]);
+	e.set_receiver(*targets_[i].get_target_ptr(t));
+	e.set_rport(targets_[i].get_rport());
+	e();
+      }
+
+      ConnectorBase::set_t_lastspike(e.get_stamp().get_ms());
+    }
+
+    void trigger_update_weight(long_t vt_gid, thread t, const vector<spikecounter>& dopa_spikes, double_t t_trig, const std::vector<ConnectorModel*> & cm)
+    {
+      const typename ConnectionT::CommonPropertiesType & cp =
+	static_cast< GenericConnectorModel<ConnectionT> * > ( cm[syn_id_] )->get_common_properties();
+      if(cp.get_vt_gid() == vt_gid)
+	for(size_t i=0; i<targets_.size(); i++)
+	  get_connection_(i).trigger_update_weight(t, dopa_spikes, t_trig, cp);
+    }
+
+    synindex get_syn_id() const
+    {
+      return syn_id_;
+    }
+
+    bool homogeneous_model() { return true; }
+
+    bool reserve(synindex syn_id, size_t n)
+    {
+      if (syn_id != syn_id_)
+	return false;
+      const size_t size = targets_.size() + n;
+      targets_.reserve(size);
+      delays_.reserve(size);
+      weights_.reserve(size);
+      return true;
+    }
+
+    void shrink_to_fit()
+    {
+      if (targets_.capacity() > targets_.size())
+	std::vector<targetidentifierT>(targets_).swap(targets_);
+      if (delays_.capacity() > delays_.size())
+	std::vector<unsigned int>(delays_).swap(delays_);
+      weights_.shrink_to_fit();
+    }
+
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      mem[syn_id_] += sizeof(*this)
+	+ targets_.capacity() * sizeof(targetidentifierT)
+	+ delays_.capacity() * sizeof(unsigned int)
+	+ weights_.get_memory();
+    }
+
+  private:
+
+    void append_(const ConnectionT & c)
+    {
+      targets_.push_back(c.get_target_identifier());
+      delays_.push_back(c.get_delay_steps());
+      weights_.push_back(c);
+    }
+
+    // reassemble connection p, e.g. to read or write its status
+    ConnectionT get_connection_(size_t p) const
+    {
+      ConnectionT c;
+      c.set_target_identifier(targets_[p]);
+      c.set_syn_id(syn_id_);
+      c.set_delay_steps(delays_[p]);
+      weights_.get(p, c);
+      return c;
+    }
+
+  };
+
+} // of namespace nest
+
+#endif
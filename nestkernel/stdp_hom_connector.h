@@ -0,0 +1,278 @@
+/*
+ *  stdp_hom_connector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STDP_HOM_CONNECTOR_H
+#define STDP_HOM_CONNECTOR_H
+
+#include <vector>
+#include <cmath>
+
+#include "connector_base.h"
+
+namespace nest
+{
+
+  // homogeneous connector for STDP synapses with common parameters,
+  // containing >=K_cutoff entries
+  // stores targets, delays, weights and Kplus in separate arrays and
+  // updates all synapses of one presynaptic spike together:
+  // - consecutive synapses onto the same target with the same delay
+  //   read the postsynaptic history and Kminus only once
+  // - the decay of Kplus since the last spike is the same for all
+  //   synapses and applied in one loop over Kplus
+  // ConnectionT must grant access to weight_, Kplus_ and to static
+  // facilitate_() and depress_(); connection models use this connector
+  // by specializing Connector<K_cutoff, ConnectionT>
+  template < typename ConnectionT, typename targetidentifierT >
+  class STDPHomConnector : public vector_like<ConnectionT>
+  {
+    typedef typename ConnectionT::CommonPropertiesType CommonPropertiesType;
+
+    std::vector<targetidentifierT> targets_;
+    std::vector<unsigned int> delays_; // in steps
+    std::vector<double_t> weights_;
+    std::vector<double_t> Kplus_;
+    synindex syn_id_;
+
+  public:
+
+    STDPHomConnector(const Connector<K_cutoff-1, ConnectionT> &C, const ConnectionT &c)
+      : syn_id_(c.get_syn_id())
+    {
+      targets_.reserve(K_cutoff);
+      delays_.reserve(K_cutoff);
+      weights_.reserve(K_cutoff);
+      Kplus_.reserve(K_cutoff);
+      for (size_t i=0; i<K_cutoff-1; i++)
+	append_(C.get_C()[i]);
+      append_(c);
+    }
+
+    ~STDPHomConnector()
+    {}
+
+    void get_synapse_status(synindex syn_id, DictionaryDatum & d, port p) const
+    {
+      if ( syn_id == syn_id_ )
+      {
+	assert (p >= 0 && static_cast<size_t>(p) < targets_.size());
+	get_connection_(p).get_status(d);
+      }
+    }
+
+    void set_synapse_status(synindex syn_id, ConnectorModel & cm, const DictionaryDatum & d, port p)
+    {
+      if ( syn_id == syn_id_ )
+      {
+	assert (p >= 0 && static_cast<size_t>(p) < targets_.size());
+	ConnectionT c = get_connection_(p);
+	c.set_status(d, static_cast< GenericConnectorModel<ConnectionT> & > (cm));
+	delays_[p] = c.get_delay_steps();
+	weights_[p] = c.weight_;
+	Kplus_[p] = c.Kplus_;
+      }
+    }
+
+    size_t get_num_connections()
+    {
+      return targets_.size();
+    }
+
+    size_t get_num_connections(synindex syn_id)
+    {
+      if (syn_id == syn_id_)
+	return targets_.size();
+      else
+	return 0;
+    }
+
+    STDPHomConnector & push_back(const ConnectionT & c)
+    {
+      append_(c);
+      return *this;
+    }
+
+    void get_connections(size_t source_gid, size_t thrd, synindex synapse_id, ArrayDatum &conns) const
+    {
+      if(syn_id_==synapse_id)
+	for ( size_t i=0; i<targets_.size(); i++ )
+	  conns.push_back(ConnectionDatum(ConnectionID(source_gid, targets_[i].get_target_ptr(thrd)->get_gid(), thrd, synapse_id, i)));
+    }
+
+    void get_connections(size_t source_gid, size_t target_gid, size_t thrd, size_t synapse_id, ArrayDatum &conns) const
+    {
+      if(syn_id_==synapse_id)
+	for ( size_t i=0; i<targets_.size(); i++ )
+	  if (targets_[i].get_target_ptr(thrd)->get_gid() == target_gid)
+	    conns.push_back(ConnectionDatum(ConnectionID(source_gid, target_gid, thrd, synapse_id, i)));
+    }
+
+    void send(Event &e, thread t, const std::vector<ConnectorModel*> & cm)
+    {
+      const CommonPropertiesType & cp =
+	static_cast< GenericConnectorModel<ConnectionT> * > ( cm[syn_id_] )->get_common_properties();
+
+      const double_t t_spike = e.get_stamp().get_ms();
+      const double_t t_lastspike = ConnectorBase::get_t_lastspike();
+      const size_t n = targets_.size();
+
+      // plasticity, for runs of synapses with the same target and delay
+      for (size_t begin=0, end=0; begin<n; begin=end)
+      {
+	Node *target = targets_[begin].get_target_ptr(t);
+	for (end=begin+1; end<n && delays_[end] == delays_[begin]
+	       && targets_[end].get_target_ptr(t) == target; end++)
+	  ;
+	update_weights_(target, begin, end, t_spike, t_lastspike, cp);
+      }
+
+      for(size_t i=0; i<n; i++)
+      {
+	e.set_port(i);
+	e.set_receiver(*targets_[i].get_target_ptr(t));
+	e.set_weight(weights_[i]);
+	e.set_delay(delays_[i]);
+	e.set_rport(targets_[i].get_rport());
+	e();
+      }
+
+      const double_t Kplus_decay = std::exp((t_lastspike - t_spike) / cp.tau_plus_);
+      double_t* const Kplus = &Kplus_[0];
+      for(size_t i=0; i<n; i++)
+	Kplus[i] = Kplus[i] * Kplus_decay + 1.0;
+
+      ConnectorBase::set_t_lastspike(t_spike);
+    }
+
+    void trigger_update_weight(long_t vt_gid, thread t, const vector<spikecounter>& dopa_spikes, double_t t_trig, const std::vector<ConnectorModel*> & cm)
+    {
+      const CommonPropertiesType & cp =
+	static_cast< GenericConnectorModel<ConnectionT> * > ( cm[syn_id_] )->get_common_properties();
+      if(cp.get_vt_gid() == vt_gid)
+	for(size_t i=0; i<targets_.size(); i++)
+	  get_connection_(i).trigger_update_weight(t, dopa_spikes, t_trig, cp);
+    }
+
+    synindex get_syn_id() const
+    {
+      return syn_id_;
+    }
+
+    bool homogeneous_model() { return true; }
+
+    bool reserve(synindex syn_id, size_t n)
+    {
+      if (syn_id != syn_id_)
+	return false;
+      const size_t size = targets_.size() + n;
+      targets_.reserve(size);
+      delays_.reserve(size);
+      weights_.reserve(size);
+      Kplus_.reserve(size);
+      return true;
+    }
+
+    void shrink_to_fit()
+    {
+      if (targets_.capacity() > targets_.size())
+	std::vector<targetidentifierT>(targets_).swap(targets_);
+      if (delays_.capacity() > delays_.size())
+	std::vector<unsigned int>(delays_).swap(delays_);
+      if (weights_.capacity() > weights_.size())
+	std::vector<double_t>(weights_).swap(weights_);
+      if (Kplus_.capacity() > Kplus_.size())
+	std::vector<double_t>(Kplus_).swap(Kplus_);
+    }
+
+    void get_memory(std::vector<size_t> & mem) const
+    {
+      mem[syn_id_] += sizeof(*this)
+	+ targets_.capacity() * sizeof(targetidentifierT)
+	+ delays_.capacity() * sizeof(unsigned int)
+	+ (weights_.capacity() + Kplus_.capacity()) * sizeof(double_t);
+    }
+
+  private:
+
+    // facilitation due to postsynaptic spikes since the last presynaptic
+    // spike, followed by depression due to the new presynaptic spike, for
+    // synapses [begin, end), which share target and delay; this is the
+    // same sequence of operations as in ConnectionT::send()
+    void update_weights_(Node *target, size_t begin, size_t end,
+			 double_t t_spike, double_t t_lastspike,
+			 const CommonPropertiesType & cp)
+    {
+      const double_t dendritic_delay = Time::delay_steps_to_ms(delays_[begin]);
+      double_t* const w = &weights_[0];
+      const double_t* const Kplus = &Kplus_[0];
+
+      histentry* start;
+      histentry* finish;
+      const bool cached = target->get_history(t_lastspike - dendritic_delay, t_spike - dendritic_delay,
+			  &start, &finish, cp.tau_plus_);
+
+      // get_history() counted one reader, count the others in the run
+      if (end - begin > 1)
+	for (histentry* runner = start; runner != finish; ++runner)
+	  runner->access_counter_ += end - begin - 1;
+
+      double_t decay = 1.0;
+      for (histentry* first = start; start != finish; ++start)
+      {
+	const double_t minus_dt = t_lastspike - (start->t_ + dendritic_delay);
+	decay = start == first ? std::exp(minus_dt / cp.tau_plus_) : decay * (cached ? start->decay_ : std::exp(-start->dt_ / cp.tau_plus_));
+	if (minus_dt == 0)
+	  continue;
+	for (size_t i=begin; i<end; i++)
+	  w[i] = ConnectionT::facilitate_(w[i], Kplus[i] * decay, cp);
+      }
+
+      const double_t Kminus = target->get_K_value(t_spike - dendritic_delay);
+      for (size_t i=begin; i<end; i++)
+	w[i] = ConnectionT::depress_(w[i], Kminus, cp);
+    }
+
+    void append_(const ConnectionT & c)
+    {
+      targets_.push_back(c.get_target_identifier());
+      delays_.push_back(c.get_delay_steps());
+      weights_.push_back(c.weight_);
+      Kplus_.push_back(c.Kplus_);
+    }
+
+    // reassemble connection p, e.g. to read or write its status
+    ConnectionT get_connection_(size_t p) const
+    {
+      ConnectionT c;
+      c.set_target_identifier(targets_[p]);
+      c.set_syn_id(syn_id_);
+      c.set_delay_steps(delays_[p]);
+      c.weight_ = weights_[p];
+      c.Kplus_ = Kplus_[p];
+      return c;
+    }
+
+  };
+
+} // of namespace nest
+
+#endif
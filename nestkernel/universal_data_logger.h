@@ -131,6 +131,9 @@ namespace nest {
       */
      void record_data(long_t);
 
+     //! Return true if no multimeter is connected, i.e., record_data() has no effect
+     bool empty() const { return data_loggers_.empty(); }
+
      //! Erase all existing data
      void reset();
 
@@ -225,7 +225,7 @@ void nest::iaf_psc_alpha_canon::init_buffers_()
 {
   B_.events_.resize();
   B_.events_.clear(); 
-  B_.currents_.clear();  // includes resize
+  B_.currents_.clear(get_buffer_arena_());  // includes resize
   B_.logger_.reset(); 
 }
 
@@ -214,10 +214,10 @@ void nest::iaf_psc_alpha_presc::init_state_(const Node& proto)
 
 void nest::iaf_psc_alpha_presc::init_buffers_()
 {
-  B_.spike_y1_.clear();  // includes resize
-  B_.spike_y2_.clear();  // includes resize
-  B_.spike_y3_.clear();  // includes resize
-  B_.currents_.clear();  // includes resize
+  B_.spike_y1_.clear(get_buffer_arena_());  // includes resize
+  B_.spike_y2_.clear(get_buffer_arena_());  // includes resize
+  B_.spike_y3_.clear(get_buffer_arena_());  // includes resize
+  B_.currents_.clear(get_buffer_arena_());  // includes resize
 
   B_.logger_.reset();
 }
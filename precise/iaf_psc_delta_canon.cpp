@@ -200,7 +200,7 @@ void nest::iaf_psc_delta_canon::init_buffers_()
 {
   B_.events_.resize();
   B_.events_.clear(); 
-  B_.currents_.clear();
+  B_.currents_.clear(get_buffer_arena_());
   B_.logger_.reset();
 }
 
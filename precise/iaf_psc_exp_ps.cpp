@@ -207,7 +207,7 @@ void nest::iaf_psc_exp_ps::init_buffers_()
 {
   B_.events_.resize();
   B_.events_.clear(); 
-  B_.currents_.clear();  // includes resize
+  B_.currents_.clear(get_buffer_arena_());  // includes resize
   B_.logger_.reset();
 }
 
@@ -377,6 +377,18 @@ void nest::iaf_psc_exp_ps::handle(SpikeEvent & e)
 		       Tdeliver, e.get_offset(), e.get_weight() * e.get_multiplicity());
 }
 
+void nest::iaf_psc_exp_ps::handle_batch(SpikeEvent & e, const long_t* lags,
+                                        const long* counts, size_t n)
+{
+  assert( e.get_delay() > 0 );
+
+  // batched spikes are on the grid; a spike at lag 0 is delivered delay
+  // steps after the slice origin, cf. handle(SpikeEvent&)
+  const long_t Tdeliver = network()->get_slice_origin().get_steps() + e.get_delay();
+
+  B_.events_.add_spikes(e.get_delay(), Tdeliver, lags, counts, e.get_weight(), n);
+}
+
 void nest::iaf_psc_exp_ps::handle(CurrentEvent & e)
 {
   assert( e.get_delay() > 0 );
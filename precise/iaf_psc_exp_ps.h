@@ -154,6 +154,8 @@ namespace nest
     void handle(SpikeEvent &);
     void handle(CurrentEvent &);
     void handle(DataLoggingRequest &);
+
+    void handle_batch(SpikeEvent &, const long_t*, const long*, size_t);
    
     bool is_off_grid() const  // uses off_grid events
     {
@@ -26,6 +26,8 @@
 #include <cmath>
 
 nest::SliceRingBuffer::SliceRingBuffer() :
+  deliver_(0),
+  next_(0),
   refract_(std::numeric_limits<long_t>::max(), 0, 0)
 {
 //  resize();  // sets up queue_
@@ -53,23 +55,98 @@ void nest::SliceRingBuffer::clear()
 {
   for ( size_t j = 0 ; j < queue_.size() ; ++j )
     queue_[j].clear();
+  next_ = 0;
 }
 
 void nest::SliceRingBuffer::prepare_delivery()
 {
+  // if the last slice was not delivered completely, remove the spikes
+  // delivered from it, so that they are not delivered again
+  if ( next_ > 0 )
+  {
+    deliver_->erase(deliver_->begin(), deliver_->begin() + next_);
+    next_ = 0;
+  }
+
   // vector to deliver from in this slice
   deliver_ = &(queue_[Scheduler::get_slice_modulo(0)]);
-  
-  // sort events, first event last
-  std::sort(deliver_->begin(), deliver_->end(), std::greater<SpikeInfo>());
+
+  // sort events, first event first, unless they arrived in order
+  if ( std::adjacent_find(deliver_->begin(), deliver_->end(),
+                          std::greater<SpikeInfo>()) != deliver_->end() )
+    sort_by_step_();
 }
 
 void nest::SliceRingBuffer::discard_events()
 {
-  // vector to deliver from in this slice
+  // remove delivered spikes of the last slice, as in prepare_delivery()
+  if ( next_ > 0 )
+  {
+    deliver_->erase(deliver_->begin(), deliver_->begin() + next_);
+    next_ = 0;
+  }
+
+  // vector to deliver from in this slice, no need to sort it
   deliver_ = &(queue_[Scheduler::get_slice_modulo(0)]);
 
   deliver_->clear();
 }
 
+void nest::SliceRingBuffer::sort_by_step_()
+{
+  // all spikes of a slot are due within one slice, so their time
+  // stamps span at most min_delay steps
+  long_t first = deliver_->front().stamp_;
+  long_t last = first;
+  bool steps_ordered = true;
+  for ( size_t i = 1 ; i < deliver_->size() ; ++i )
+  {
+    const long_t stamp = (*deliver_)[i].stamp_;
+    steps_ordered = steps_ordered && stamp >= (*deliver_)[i-1].stamp_;
+    first = std::min(first, stamp);
+    last = std::max(last, stamp);
+  }
+  const size_t n_steps = last - first + 1;
+  assert(n_steps <= static_cast<size_t>(Scheduler::get_min_delay()));
+
+  // with few spikes per step, sorting directly is cheaper
+  if ( deliver_->size() < 2 * n_steps )
+  {
+    std::sort(deliver_->begin(), deliver_->end());
+    return;
+  }
+
+  // unless spikes arrived ordered by step, counting sort by time stamp;
+  // afterwards, the spikes of step s end at step_end_[s]
+  step_end_.assign(n_steps, 0);
+  for ( size_t i = 0 ; i < deliver_->size() ; ++i )
+    ++step_end_[(*deliver_)[i].stamp_ - first];
+
+  size_t begin = 0;
+  for ( size_t s = 0 ; s < n_steps ; ++s )
+  {
+    const size_t count = step_end_[s];
+    step_end_[s] = begin;
+    begin += count;
+  }
 
+  if ( steps_ordered )
+    for ( size_t s = 0 ; s < n_steps ; ++s )
+      step_end_[s] = s + 1 < n_steps ? step_end_[s+1] : deliver_->size();
+  else
+  {
+    sorted_.resize(deliver_->size(), deliver_->front());
+    for ( size_t i = 0 ; i < deliver_->size() ; ++i )
+      sorted_[step_end_[(*deliver_)[i].stamp_ - first]++] = (*deliver_)[i];
+    deliver_->swap(sorted_);
+  }
+
+  // sort spikes within each step by offset
+  begin = 0;
+  for ( size_t s = 0 ; s < n_steps ; ++s )
+  {
+    if ( step_end_[s] - begin > 1 )
+      std::sort(deliver_->begin() + begin, deliver_->begin() + step_end_[s]);
+    begin = step_end_[s];
+  }
+}
@@ -36,8 +36,9 @@ namespace nest
 {
   /**
    * Queue for all spikes arriving into a neuron.
-   * Spikes are stored unsorted on arrival, but are sorted when
-   * prepare_delivery() is called.  They can then be retrieved
+   * Spikes are inserted into one bucket per min_delay slice on arrival
+   * and kept in temporal order within the bucket, so that no sorting
+   * is needed before delivery.  They can then be retrieved
    * one by one in correct temporal order.  Coinciding spikes
    * are combined into one, see get_next_spike().
    *
@@ -45,9 +46,15 @@ namespace nest
    * - The time of the next return from refractoriness is 
    *   stored in a separate variable and checked explicitly;
    *   otherwise, we'd have to re-sort data during updating.
-   * - We have a pseudo-ring of Nbuff=ceil((min_del+max_del)/min_del) elements.
-   *   Each element is a vector storing incoming spikes that
-   *   are due during a given time slice.  
+   * - We have a ring of ceil((min_del+max_del)/min_del) elements.
+   *   Each element is a vector storing incoming spikes that are due
+   *   during a given slice.  Spikes are appended on arrival and put
+   *   into temporal order, i.e., by increasing time stamp and decreasing
+   *   offset, before delivery.  Spikes often arrive in that order, e.g.
+   *   from devices, and then need no sorting; otherwise they are sorted
+   *   by time step in linear time, and by offset within each step.
+   *   Spikes are delivered from a read index, and the vector is cleared
+   *   once all its spikes are delivered.
    *
    * @note The following assumptions underlie the handling of 
    * pseudo-events for return from refractoriness:
@@ -67,6 +74,22 @@ namespace nest
      */
     void add_spike(const delay rel_delivery, const long_t stamp,
 		   const double ps_offset, const double weight);
+
+    /**
+     * Add on-grid spikes of several steps to queue.
+     * For each lag with a non-zero count, adds a spike of weight
+     * weight * counts[i] delivered lags[i] steps after a spike at lag 0.
+     * The lags must be ascending and lie in [0, min_delay).
+     * @param  rel_delivery relative delivery time of a spike at lag 0
+     * @param  stamp      Delivery time of a spike at lag 0
+     * @param  lags       Lags of the spikes
+     * @param  counts     Number of spikes at each lag
+     * @param  weight     Weight of a single spike
+     * @param  n          Number of lags
+     */
+    void add_spikes(const delay rel_delivery, const long_t stamp,
+		    const long_t* lags, const long* counts,
+		    const double weight, const size_t n);
     
     /**
      * Add refractory event to queue.
@@ -77,7 +100,7 @@ namespace nest
     void add_refractory(const long_t stamp, const double_t ps_offset);
 
     /**
-     * Prepare for spike delivery in current slice by sorting.
+     * Prepare for spike delivery in current slice.
      */
     void prepare_delivery();
 
@@ -135,12 +158,26 @@ namespace nest
       double_t weight_;    //<! spike weight
     };
 
+    /**
+     * Sort spikes in *deliver_ into temporal order.
+     */
+    void sort_by_step_();
+
     //! entire queue, one slot per min_delay block within max_delay
     std::vector<std::vector<SpikeInfo> > queue_;
 
     //! slot to deliver from
     std::vector<SpikeInfo> * deliver_;  
 
+    //! index of next spike to deliver in *deliver_
+    size_t next_;
+
+    //! scratch space for sort_by_step_(), kept to avoid reallocation
+    std::vector<SpikeInfo> sorted_;
+
+    //! end of each time step's spikes, see sort_by_step_()
+    std::vector<size_t> step_end_;
+
     SpikeInfo  refract_;  //!< pseudo-event for return from refractoriness
 
   };
@@ -153,7 +190,28 @@ namespace nest
     assert((size_t) idx < queue_.size());
     assert(ps_offset >= 0);  
     
-    queue_[idx].push_back(SpikeInfo(stamp, ps_offset, weight)); 
+    queue_[idx].push_back(SpikeInfo(stamp, ps_offset, weight));
+  }
+
+  inline
+  void SliceRingBuffer::add_spikes(const delay rel_delivery, const long_t stamp,
+				   const long_t* lags, const long* counts,
+				   const double weight, const size_t n)
+  {
+    // the lags span less than min_delay, so the spikes fall into at most
+    // two slots; reserve once instead of growing per spike
+    const delay first = Scheduler::get_slice_modulo(rel_delivery);
+    assert((size_t) first < queue_.size());
+    queue_[first].reserve(queue_[first].size() + n);
+
+    // lags are ascending, so these spikes are in temporal order
+    for ( size_t i = 0 ; i < n ; ++i )
+      if ( counts[i] > 0 )
+      {
+	assert(0 <= lags[i] && (delay)lags[i] < Scheduler::get_min_delay());
+	const delay idx = Scheduler::get_slice_modulo(rel_delivery + lags[i]);
+	queue_[idx].push_back(SpikeInfo(stamp + lags[i], 0.0, weight * counts[i]));
+      }
   }
 
   inline
@@ -175,7 +233,7 @@ namespace nest
                                        bool& end_of_refract)
   {
     end_of_refract = false;
-    if ( deliver_->empty() || refract_ <= deliver_->back() )
+    if ( next_ == deliver_->size() || refract_ <= (*deliver_)[next_] )
       if ( refract_.stamp_ == req_stamp )  
 	{ // if relies on stamp_==long_t::max() if not refractory
 	  // return from refractoriness
@@ -189,20 +247,27 @@ namespace nest
 	}
       else
 	return false;
-    else if ( deliver_->back().stamp_ == req_stamp )
+    else if ( (*deliver_)[next_].stamp_ == req_stamp )
       {
 	// we have an event to deliver, register its offset
-	ps_offset = deliver_->back().ps_offset_;
+	ps_offset = (*deliver_)[next_].ps_offset_;
 
 	// accumulate weights of all spikes with same stamp
 	// AND offset
 	weight    = 0.0;  // accumulate weights of all
-	while ( !deliver_->empty()
-		&& deliver_->back().ps_offset_ == ps_offset 
-		&& deliver_->back().stamp_ == req_stamp     )
+	while ( next_ < deliver_->size()
+		&& (*deliver_)[next_].ps_offset_ == ps_offset 
+		&& (*deliver_)[next_].stamp_ == req_stamp     )
+	  {
+	    weight += (*deliver_)[next_].weight_;
+	    ++next_;
+	  }
+
+	// all spikes delivered, slot is free for a later slice
+	if ( next_ == deliver_->size() )
 	  {
-	    weight += deliver_->back().weight_;
-	    deliver_->pop_back();
+	    deliver_->clear();
+	    next_ = 0;
 	  }
 
 	return true;
@@ -210,7 +275,7 @@ namespace nest
     else
       {
 	// ensure that we are not blocked by spike from the past, cf #404
-	assert( deliver_->back().stamp_ > req_stamp );
+	assert( (*deliver_)[next_].stamp_ > req_stamp );
 	return false;
       }
   }
@@ -1031,6 +1031,9 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
     In addition, switches setting permission for establishing self-connections 
     ('autapses', default: True) and multiple connections between a pair of nodes 
     ('multapses', default: True) can be contained in the dictionary.
+    With 'bulk_connect' (default: False), connections are first collected
+    and then created source by source, which reduces the number of memory
+    allocations for large networks at the cost of temporary memory.
 
     Available rules and their associated parameters are:
      - 'all_to_all' (default)
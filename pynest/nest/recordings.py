@@ -0,0 +1,183 @@
+# -*- coding: utf-8 -*-
+#
+# recordings.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions to read binary files written by recording devices.
+"""
+
+import numpy
+
+MAPPED_MAGIC = b'NESTMMAP'
+MAPPED_BYTE_ORDER = 0x01020304
+MAPPED_VERSION = 2
+
+
+def mapped_header_dtype(byteorder='<'):
+    """Header of memory-mapped spike files in the given byte order"""
+
+    return numpy.dtype([('magic', 'S8'),
+                        ('byte_order', byteorder + 'u4'),
+                        ('version', byteorder + 'u4'),
+                        ('record_size', byteorder + 'u4'),
+                        ('reserved', byteorder + 'u4'),
+                        ('n_records', byteorder + 'u8'),
+                        ('resolution', byteorder + 'f8')])
+
+
+def mapped_record_dtype(byteorder='<'):
+    """Record of memory-mapped spike files in the given byte order"""
+
+    return numpy.dtype([('senders', byteorder + 'u8'),
+                        ('steps', byteorder + 'i8'),
+                        ('offsets', byteorder + 'f8'),
+                        ('weights', byteorder + 'f8')])
+
+
+def read_mapped_spikes(fname):
+    """
+    Read a file written by a spike_detector with /memory_mapped true.
+
+    Returns a tuple (records, resolution), where records is a
+    numpy.memmap structured array with the fields 'senders', 'steps',
+    'offsets' and 'weights', and resolution is the simulation
+    resolution in ms. Spike times in ms are given by
+    records['steps'] * resolution - records['offsets'].
+
+    Files are written in the byte order of the machine running NEST;
+    the byte order is taken from the header, so files can be read on
+    machines of either byte order.
+
+    The records are not copied, so this is cheap for large files. The
+    file may still be open in NEST; only records written so far are
+    returned.
+    """
+
+    header = numpy.fromfile(fname, dtype=mapped_header_dtype(), count=1)
+    if len(header) != 1 or header['magic'][0] != MAPPED_MAGIC:
+        raise ValueError("%s is not a memory-mapped spike file." % fname)
+
+    byteorder = '<'
+    if header['byte_order'][0] != MAPPED_BYTE_ORDER:
+        byteorder = '>'
+        header = numpy.fromfile(fname, dtype=mapped_header_dtype(byteorder),
+                                count=1)
+        if header['byte_order'][0] != MAPPED_BYTE_ORDER:
+            raise ValueError("Invalid byte order mark in %s." % fname)
+
+    if header['version'][0] != MAPPED_VERSION:
+        raise ValueError("Unsupported memory-mapped spike file version %d."
+                         % header['version'][0])
+
+    record_dtype = mapped_record_dtype(byteorder)
+    if header['record_size'][0] != record_dtype.itemsize:
+        raise ValueError("Unexpected record size %d in %s."
+                         % (header['record_size'][0], fname))
+
+    n = int(header['n_records'][0])
+    if n == 0:
+        records = numpy.zeros(0, dtype=record_dtype)
+    else:
+        records = numpy.memmap(fname, dtype=record_dtype, mode='r',
+                               offset=header.dtype.itemsize, shape=(n,))
+
+    return records, float(header['resolution'][0])
+
+
+COLUMNS_MAGIC = b'NESTCOLS'
+COLUMNS_BYTE_ORDER = 0x01020304
+COLUMNS_VERSION = 2
+
+
+def columns_header_dtype(byteorder='<'):
+    """Header of columnar recording files in the given byte order"""
+
+    return numpy.dtype([('magic', 'S8'),
+                        ('byte_order', byteorder + 'u4'),
+                        ('version', byteorder + 'u4'),
+                        ('n_columns', byteorder + 'u4'),
+                        ('reserved', byteorder + 'u4'),
+                        ('resolution', byteorder + 'f8')])
+
+
+columns_schema_dtype = numpy.dtype([('name', 'S32'),
+                                    ('dtype', 'S8')])
+
+
+def read_columns(fname):
+    """
+    Read a file written by a recording device with /columnar true.
+
+    Returns a tuple (columns, resolution), where columns is a
+    dictionary mapping each column name (e.g. 'senders', 'times' or a
+    recorded quantity like 'V_m') to a numpy array, and resolution is
+    the simulation resolution in ms.
+
+    Files are written in the byte order of the machine running NEST;
+    the byte order is taken from the header, so files can be read on
+    machines of either byte order.
+    """
+
+    with open(fname, 'rb') as f:
+        data = f.read()
+
+    header = numpy.frombuffer(data, dtype=columns_header_dtype(), count=1)
+    if header['magic'][0] != COLUMNS_MAGIC:
+        raise ValueError("%s is not a columnar recording file." % fname)
+
+    byteorder = '<'
+    if header['byte_order'][0] != COLUMNS_BYTE_ORDER:
+        byteorder = '>'
+        header = numpy.frombuffer(data, dtype=columns_header_dtype(byteorder),
+                                  count=1)
+        if header['byte_order'][0] != COLUMNS_BYTE_ORDER:
+            raise ValueError("Invalid byte order mark in %s." % fname)
+
+    if header['version'][0] != COLUMNS_VERSION:
+        raise ValueError("Unsupported columnar recording file version %d."
+                         % header['version'][0])
+
+    n_columns = int(header['n_columns'][0])
+    pos = header.dtype.itemsize
+    schema = numpy.frombuffer(data, dtype=columns_schema_dtype,
+                              count=n_columns, offset=pos)
+    pos += n_columns * columns_schema_dtype.itemsize
+
+    names = [s['name'].decode() for s in schema]
+    dtypes = [numpy.dtype(s['dtype'].decode()) for s in schema]
+
+    blocks = dict((name, []) for name in names)
+    while pos < len(data):
+        n_rows = int(numpy.frombuffer(data, dtype=byteorder + 'u8', count=1,
+                                      offset=pos)[0])
+        pos += 8
+        for name, dtype in zip(names, dtypes):
+            blocks[name].append(numpy.frombuffer(data, dtype=dtype,
+                                                 count=n_rows, offset=pos))
+            pos += n_rows * dtype.itemsize
+
+    columns = {}
+    for name, dtype in zip(names, dtypes):
+        if blocks[name]:
+            columns[name] = numpy.concatenate(blocks[name])
+        else:
+            columns[name] = numpy.zeros(0, dtype=dtype)
+
+    return columns, float(header['resolution'][0])
@@ -36,6 +36,7 @@ from . import test_connect_fixed_outdegree
 from . import test_connect_fixed_total_number
 from . import test_connect_one_to_one
 from . import test_connect_pairwise_bernoulli
+from . import test_connect_bulk
 from . import test_findconnections
 from . import test_getconnections
 from . import test_dataconnect
@@ -44,6 +45,7 @@ from . import test_networks
 from . import test_threads
 from . import test_csa
 from . import test_quantal_stp_synapse
+from . import test_recordings
 
 
 def suite():
@@ -62,6 +64,7 @@ def suite():
     suite.addTest(test_connect_fixed_total_number.suite())
     suite.addTest(test_connect_one_to_one.suite())
     suite.addTest(test_connect_pairwise_bernoulli.suite())
+    suite.addTest(test_connect_bulk.suite())
     suite.addTest(test_findconnections.suite())    
     suite.addTest(test_getconnections.suite())
     suite.addTest(test_dataconnect.suite())
@@ -70,6 +73,7 @@ def suite():
     suite.addTest(test_threads.suite())    
     suite.addTest(test_csa.suite())    
     suite.addTest(test_quantal_stp_synapse.suite())    
+    suite.addTest(test_recordings.suite())
     
     return suite
 
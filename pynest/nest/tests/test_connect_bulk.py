@@ -0,0 +1,89 @@
+# -*- coding: utf-8 -*-
+#
+# test_connect_bulk.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Tests for bulk connection construction (conn_spec 'bulk_connect')
+"""
+
+import unittest
+import nest
+
+
+@nest.check_stack
+class BulkConnectTestCase(unittest.TestCase):
+    """Connections created in bulk equal connections created one by one"""
+
+    def connections(self, conn_spec, syn_spec, n_threads, post_model):
+        """Build network, return sorted list of connection properties"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'local_num_threads': n_threads})
+        pre = nest.Create('iaf_neuron', 20)
+        post = nest.Create(post_model, 30)
+        if post_model == 'iaf_psc_exp_multisynapse':
+            nest.SetStatus(post, {'tau_syn': [0.5, 1.0, 2.0]})
+        nest.Connect(pre, post, conn_spec, syn_spec)
+
+        conns = nest.GetConnections(pre)
+        props = nest.GetStatus(conns, ['source', 'target', 'port',
+                                       'weight', 'delay', 'receptor'])
+        return sorted(props)
+
+    def compare(self, conn_spec, syn_spec, post_model='iaf_neuron'):
+        bulk_spec = dict(conn_spec, bulk_connect=True)
+        for n_threads in [1, 4]:
+            self.assertEqual(
+                self.connections(conn_spec, syn_spec, n_threads, post_model),
+                self.connections(bulk_spec, syn_spec, n_threads, post_model))
+
+    def test_FixedInDegree(self):
+        """Fixed indegree with random weights and delays"""
+
+        self.compare({'rule': 'fixed_indegree', 'indegree': 15},
+                     {'weight': {'distribution': 'normal', 'mu': 1.0, 'sigma': 0.5},
+                      'delay': {'distribution': 'uniform', 'low': 1.0, 'high': 3.0}})
+
+    def test_AllToAll(self):
+        """All to all with default weight and delay"""
+
+        self.compare({'rule': 'all_to_all'}, {'model': 'static_synapse'})
+
+    def test_Bernoulli(self):
+        """Pairwise Bernoulli with receptor type"""
+
+        self.compare({'rule': 'pairwise_bernoulli', 'p': 0.3},
+                     {'delay': 2.0, 'receptor_type': 2,
+                      'weight': {'distribution': 'uniform', 'low': 0.5, 'high': 1.5}},
+                     'iaf_psc_exp_multisynapse')
+
+
+def suite():
+
+    suite = unittest.makeSuite(BulkConnectTestCase,'test')
+    return suite
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
@@ -0,0 +1,212 @@
+# -*- coding: utf-8 -*-
+#
+# test_recordings.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Tests for reading binary files written by recording devices
+"""
+
+import unittest
+import tempfile
+import shutil
+import nest
+
+try:
+    import numpy
+    import nest.recordings
+    HAVE_NUMPY = True
+except ImportError:
+    HAVE_NUMPY = False
+
+
+@nest.check_stack
+@unittest.skipIf(not HAVE_NUMPY, 'Python package numpy is not available')
+class RecordingsTestCase(unittest.TestCase):
+    """Tests for binary recording files"""
+
+    def setUp(self):
+
+        self.data_path = tempfile.mkdtemp()
+
+    def tearDown(self):
+
+        shutil.rmtree(self.data_path)
+
+    def test_MappedSpikes(self):
+        """Memory-mapped spike file matches spikes recorded in memory"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'data_path': self.data_path,
+                              'overwrite_files': True})
+
+        n = nest.Create('iaf_psc_alpha', 10, {'I_e': 500.})
+        sd = nest.Create('spike_detector', params={'to_file': True,
+                                                   'to_memory': True,
+                                                   'memory_mapped': True,
+                                                   'close_after_simulate': True})
+        nest.ConvergentConnect(n, sd)
+        nest.Simulate(200.)
+
+        status = nest.GetStatus(sd)[0]
+        events = status['events']
+        self.assertTrue(status['memory_mapped'])
+        self.assertTrue(status['n_events'] > 0)
+
+        fname = '%s/spike_detector-%d-0.gdf' % (self.data_path, sd[0])
+        records, resolution = nest.recordings.read_mapped_spikes(fname)
+
+        self.assertEqual(resolution, nest.GetKernelStatus('resolution'))
+        self.assertEqual(len(records), status['n_events'])
+        self.assertEqual(list(records['senders']), list(events['senders']))
+        times = records['steps'] * resolution - records['offsets']
+        self.assertTrue(numpy.allclose(times, events['times']))
+
+    def test_MappedSpikesByteOrder(self):
+        """Memory-mapped spike files are read in either byte order"""
+
+        for byteorder in ('<', '>'):
+            header_dtype = nest.recordings.mapped_header_dtype(byteorder)
+            record_dtype = nest.recordings.mapped_record_dtype(byteorder)
+
+            header = numpy.zeros(1, dtype=header_dtype)
+            header['magic'] = nest.recordings.MAPPED_MAGIC
+            header['byte_order'] = nest.recordings.MAPPED_BYTE_ORDER
+            header['version'] = nest.recordings.MAPPED_VERSION
+            header['record_size'] = record_dtype.itemsize
+            header['n_records'] = 3
+            header['resolution'] = 0.1
+
+            records = numpy.zeros(3, dtype=record_dtype)
+            records['senders'] = [1, 7, 2 ** 40]
+            records['steps'] = [10, 11, 2 ** 40]
+            records['offsets'] = [0.0, 0.05, 0.025]
+            records['weights'] = [1.0, -2.0, 3.0]
+
+            fname = '%s/mapped.gdf' % self.data_path
+            with open(fname, 'wb') as f:
+                f.write(header.tobytes())
+                f.write(records.tobytes())
+
+            read, resolution = nest.recordings.read_mapped_spikes(fname)
+
+            self.assertEqual(header_dtype.itemsize, 40)
+            self.assertEqual(resolution, 0.1)
+            for field in ('senders', 'steps', 'offsets', 'weights'):
+                self.assertEqual(list(read[field]), list(records[field]))
+
+    def test_BinaryColumns(self):
+        """Binary columnar files match data recorded in memory"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'data_path': self.data_path,
+                              'overwrite_files': True})
+
+        params = {'to_file': True, 'to_memory': True, 'columnar': True,
+                  'close_after_simulate': True}
+
+        n = nest.Create('iaf_psc_alpha', 10, {'I_e': 500.})
+        sd = nest.Create('spike_detector', params=params)
+        mm = nest.Create('multimeter', params=params)
+        nest.SetStatus(mm, {'record_from': ['V_m'], 'interval': 0.5})
+        nest.ConvergentConnect(n, sd)
+        nest.DivergentConnect(mm, n)
+        nest.Simulate(200.)
+
+        for dev, name in ((sd, 'spike_detector-%d-0.gdf'),
+                          (mm, 'multimeter-%d-0.dat')):
+            events = nest.GetStatus(dev, 'events')[0]
+            fname = '%s/%s' % (self.data_path, name % dev[0])
+            columns, resolution = nest.recordings.read_columns(fname)
+
+            self.assertEqual(sorted(columns.keys()), sorted(events.keys()))
+            for key in events:
+                self.assertTrue(numpy.allclose(columns[key], events[key]))
+
+    def test_BinaryColumnsByteOrder(self):
+        """Binary columnar files are read in either byte order"""
+
+        for byteorder in ('<', '>'):
+            header = numpy.zeros(
+                1, dtype=nest.recordings.columns_header_dtype(byteorder))
+            header['magic'] = nest.recordings.COLUMNS_MAGIC
+            header['byte_order'] = nest.recordings.COLUMNS_BYTE_ORDER
+            header['version'] = nest.recordings.COLUMNS_VERSION
+            header['n_columns'] = 2
+            header['resolution'] = 0.1
+
+            schema = numpy.zeros(2, dtype=nest.recordings.columns_schema_dtype)
+            schema['name'] = [b'senders', b'times']
+            schema['dtype'] = [(byteorder + 'u8').encode(),
+                               (byteorder + 'f8').encode()]
+
+            senders = numpy.array([1, 7, 2 ** 40], dtype=byteorder + 'u8')
+            times = numpy.array([0.1, 2.5, 1e3], dtype=byteorder + 'f8')
+            n_rows = numpy.array([len(senders)], dtype=byteorder + 'u8')
+
+            fname = '%s/columns.gdf' % self.data_path
+            with open(fname, 'wb') as f:
+                f.write(header.tobytes())
+                f.write(schema.tobytes())
+                for block in (n_rows, senders, times, n_rows, senders, times):
+                    f.write(block.tobytes())
+
+            columns, resolution = nest.recordings.read_columns(fname)
+
+            self.assertEqual(resolution, 0.1)
+            self.assertEqual(list(columns['senders']), 2 * list(senders))
+            self.assertEqual(list(columns['times']), 2 * list(times))
+
+    def test_BinaryModeWritesText(self):
+        """Files written with /binary true still hold text records"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'data_path': self.data_path,
+                              'overwrite_files': True})
+
+        n = nest.Create('iaf_psc_alpha', 10, {'I_e': 500.})
+        sd = nest.Create('spike_detector', params={'to_file': True,
+                                                   'to_memory': True,
+                                                   'binary': True,
+                                                   'close_after_simulate': True})
+        nest.ConvergentConnect(n, sd)
+        nest.Simulate(200.)
+
+        events = nest.GetStatus(sd, 'events')[0]
+        fname = '%s/spike_detector-%d-0.gdf' % (self.data_path, sd[0])
+        data = numpy.loadtxt(fname, ndmin=2)
+
+        self.assertEqual(len(data), len(events['senders']))
+        self.assertEqual(list(data[:, 0]), list(events['senders']))
+        self.assertTrue(numpy.allclose(data[:, 1], events['times'], atol=1e-3))
+
+
+def suite():
+
+    suite = unittest.makeSuite(RecordingsTestCase, 'test')
+    return suite
+
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
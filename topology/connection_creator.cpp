@@ -20,6 +20,8 @@
  *
  */
 
+#include <cmath>
+
 #include "connection_creator.h"
 
 namespace nest
@@ -33,10 +35,14 @@ namespace nest
     number_of_connections_(0),
     mask_(),
     kernel_(),
+    constant_kernel_(false),
+    kernel_p_(0.0),
+    log_q_(0.0),
     synapse_model_(TopologyModule::get_network().get_synapsedict()["static_synapse"]),
     weight_(),
     delay_(),
-    net_(TopologyModule::get_network())
+    net_(TopologyModule::get_network()),
+    rng_purpose_(net_.new_rng_purpose())
   {
     Name connection_type;
 
@@ -107,6 +113,15 @@ namespace nest
 
     }
 
+    // A constant kernel gives the same connection probability for all
+    // pairs, so that rejected sources can be skipped at once.
+    if ( kernel_.valid() and kernel_->is_constant() ) {
+      librandom::RngPtr rng;  // not used by constant parameters
+      constant_kernel_ = true;
+      kernel_p_ = kernel_->value(Position<2>(), rng);
+      log_q_ = std::log(1.0 - kernel_p_);
+    }
+
     // Set default weight and delay if not given explicitly
     DictionaryDatum syn_defaults = net_.get_connector_defaults(synapse_model_);
     if ( not weight_.valid() )
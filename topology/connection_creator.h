@@ -125,6 +125,16 @@ namespace nest
       std::vector<std::pair<Position<D>,index> >* positions_;
     };
 
+    /**
+     * Advance iter past the candidates rejected before the next one
+     * accepted with the probability given by a constant kernel. The
+     * number of rejected candidates is geometrically distributed, so
+     * that one random number is drawn per accepted candidate instead
+     * of one per candidate.
+     */
+    template<typename Iterator>
+    void skip_rejected_(Iterator& iter, const Iterator& end, librandom::RngPtr& rng) const;
+
     template<typename Iterator, int D>
     void connect_to_target_(Iterator from, Iterator to, Node* tgt_ptr,  
 			    const Position<D>& tgt_pos, thread tgt_thread, const Layer<D>& source);
@@ -162,11 +172,15 @@ namespace nest
     index number_of_connections_;
     lockPTR<AbstractMask> mask_;
     lockPTR<Parameter> kernel_;
+    bool constant_kernel_;  //!< kernel_ is valid and constant, use skip_rejected_()
+    double_t kernel_p_;     //!< value of a constant kernel
+    double_t log_q_;        //!< log(1 - kernel_p_)
     index synapse_model_;
     lockPTR<Parameter> weight_;
     lockPTR<Parameter> delay_;
 
     Network& net_;
+    ulong_t rng_purpose_;  //!< purpose for Network::get_stream_rng()
   };
 
   inline 
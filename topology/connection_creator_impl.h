@@ -73,12 +73,48 @@ namespace nest
     delay  = delay_ ->value(pos, rng);
   }
 
+  template<typename Iterator>
+  void ConnectionCreator::skip_rejected_(Iterator& iter, const Iterator& end,
+					 librandom::RngPtr& rng) const
+  {
+    if ( kernel_p_ >= 1.0 )
+      return;
+    if ( kernel_p_ <= 0.0 ) {
+      iter = end;
+      return;
+    }
+
+    // 1 - drand() lies in (0, 1], so the logarithm is finite
+    double_t skip = std::floor(std::log(1.0 - rng->drand()) / log_q_);
+    for ( ; skip > 0 and iter != end ; --skip )
+      ++iter;
+  }
+
   template<typename Iterator, int D>
   void ConnectionCreator::connect_to_target_(Iterator from, Iterator to, Node* tgt_ptr,
 					     const Position<D>& tgt_pos, thread tgt_thread,
 					     const Layer<D>& source)
   {
-    librandom::RngPtr rng = net_.get_rng(tgt_thread);
+    // with vp_independent_rng, draw from the stream of this target
+    librandom::RngPtr rng = net_.get_stream_rng(tgt_thread, 0, tgt_ptr->get_gid(), rng_purpose_);
+
+    if ( constant_kernel_ )
+    {
+      // the trial for an autapse is drawn, but discarded
+      Iterator iter = from;
+      for ( skip_rejected_(iter, to, rng) ; iter != to ; ++iter, skip_rejected_(iter, to, rng) )
+      {
+	if ( (not allow_autapses_) and (iter->second == tgt_ptr->get_gid()) )
+	  continue;
+
+	const Position<D> disp = source.compute_displacement(tgt_pos,iter->first);
+	connect_(iter->second, tgt_ptr, tgt_thread,
+		     weight_->value(disp, rng),
+		     delay_->value(disp, rng),
+		     synapse_model_);
+      }
+      return;
+    }
 
     const bool without_kernel = not kernel_.valid();
     for ( Iterator iter = from ; iter != to ; ++iter )
@@ -247,13 +283,28 @@ namespace nest
 
         index target_id = (*tgt_it)->get_gid();
 	thread target_thread = (*tgt_it)->get_thread();
-        librandom::RngPtr rng = net_.get_rng(target_thread);
+        librandom::RngPtr rng = net_.get_stream_rng(target_thread, 0, target_id, rng_purpose_);
         Position<D> target_pos = target.get_position((*tgt_it)->get_subnet_index());
 
         // If there is a kernel, we create connections conditionally,
         // otherwise all sources within the mask are created. Test moved
         // outside the loop for efficiency.
-        if (kernel_.valid()) {
+        if (constant_kernel_) {
+
+          // the trial for an autapse is drawn, but discarded
+          const typename Ntree<D,index>::masked_iterator end = masked_layer.end();
+          typename Ntree<D,index>::masked_iterator iter = masked_layer.begin(target_pos);
+          for(skip_rejected_(iter, end, rng); iter!=end; ++iter, skip_rejected_(iter, end, rng)) {
+
+            if ((not allow_autapses_) and (iter->second == target_id))
+              continue;
+
+	    double w, d;
+            get_parameters_(target.compute_displacement(iter->first, target_pos), rng, w, d);
+            net_.connect(iter->second, *tgt_it, target_thread, synapse_model_, d, w);
+          }
+
+        } else if (kernel_.valid()) {
 
           for(typename Ntree<D,index>::masked_iterator iter=masked_layer.begin(target_pos); iter!=masked_layer.end(); ++iter) {
 
@@ -296,13 +347,28 @@ namespace nest
 
         index target_id = (*tgt_it)->get_gid();
 	thread target_thread = (*tgt_it)->get_thread();
-        librandom::RngPtr rng = net_.get_rng(target_thread);
+        librandom::RngPtr rng = net_.get_stream_rng(target_thread, 0, target_id, rng_purpose_);
         Position<D> target_pos = target.get_position((*tgt_it)->get_subnet_index());
 
         // If there is a kernel, we create connections conditionally,
         // otherwise all sources within the mask are created. Test moved
         // outside the loop for efficiency.
-        if (kernel_.valid()) {
+        if (constant_kernel_) {
+
+          // the trial for an autapse is drawn, but discarded
+          const typename std::vector<std::pair<Position<D>,index> >::iterator end = positions->end();
+          typename std::vector<std::pair<Position<D>,index> >::iterator iter = positions->begin();
+          for(skip_rejected_(iter, end, rng); iter!=end; ++iter, skip_rejected_(iter, end, rng)) {
+
+            if ((not allow_autapses_) and (iter->second == target_id))
+              continue;
+
+	    double w,d;
+            get_parameters_(target.compute_displacement(iter->first,target_pos), rng, w, d);
+            net_.connect(iter->second, *tgt_it, target_thread, synapse_model_, d, w);
+          }
+
+        } else if (kernel_.valid()) {
 
           for(typename std::vector<std::pair<Position<D>,index> >::iterator iter=positions->begin();iter!=positions->end();++iter) {
 
@@ -365,7 +431,7 @@ namespace nest
 
         index target_id = (*tgt_it)->get_gid();
 	thread target_thread = (*tgt_it)->get_thread();
-        librandom::RngPtr rng = net_.get_rng(target_thread);
+        librandom::RngPtr rng = net_.get_stream_rng(target_thread, 0, target_id, rng_purpose_);
         Position<D> target_pos = target.get_position((*tgt_it)->get_subnet_index());
 
         // Get (position,GID) pairs for sources inside mask
@@ -469,7 +535,7 @@ namespace nest
 
         index target_id = (*tgt_it)->get_gid();
 	thread target_thread = (*tgt_it)->get_thread();
-        librandom::RngPtr rng = net_.get_rng(target_thread);
+        librandom::RngPtr rng = net_.get_stream_rng(target_thread, 0, target_id, rng_purpose_);
         Position<D> target_pos = target.get_position((*tgt_it)->get_subnet_index());
 
         if ( (positions->size()==0) or
@@ -123,6 +123,13 @@ namespace nest
      */
     double_t value(const std::vector<double_t> &pt, librandom::RngPtr& rng) const;
 
+    /**
+     * @returns true if the value neither depends on the position nor
+     * on random numbers.
+     */
+    virtual bool is_constant() const
+      { return false; }
+
     /**
      * Clone method.
      * @returns dynamically allocated copy of parameter object
@@ -185,6 +192,9 @@ namespace nest
     double_t raw_value(const Position<3> &, librandom::RngPtr&) const
       { return value_; }
 
+    bool is_constant() const
+      { return true; }
+
     Parameter * clone() const
       { return new ConstantParameter(value_); }
 